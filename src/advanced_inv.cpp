@@ -20,6 +20,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <algorithm>
 #include <string>
 #include <sstream>
@@ -574,6 +575,8 @@ void advanced_inv_area::init()
         case AIM_NORTHWEST:
         case AIM_NORTH:
         case AIM_NORTHEAST:
+            // items might be moved from here, funnels collect the rain they got meanwhile
+            g->m.fill_funnels( pos );
             veh = g->m.veh_at( pos, vstor );
             if( veh != nullptr ) {
                 vstor = veh->part_with_feature( vstor, "CARGO", false );
@@ -681,7 +684,7 @@ advanced_inv_listitem::advanced_inv_listitem( item *an_item, int index, int coun
     , it( an_item )
     , name( an_item->tname( count ) )
     , name_without_prefix( an_item->tname( 1, false ) )
-    , autopickup( hasPickupRule( an_item->tname( 1, false ) ) )
+    , autopickup( hasPickupRule( name_without_prefix ) )
     , stacks( count )
     , volume( an_item->volume() * stacks )
     , weight( an_item->weight() * stacks )
@@ -757,6 +760,9 @@ static itemslice i_stacked( Container items )
 {
     //create a new container for our stacked items
     itemslice islice;
+    // positions in islice of the stacks of each item type, only those stacks
+    // can take an item, large piles would be quadratic otherwise
+    std::unordered_map<const itype *, std::vector<size_t>> stacks_by_type;
 
     //iterate through all items in the vector
     for( auto &items_it : items ) {
@@ -767,24 +773,21 @@ static itemslice i_stacked( Container items )
         }
         bool list_exists = false;
 
-        //iterate through stacked item lists
-        for( auto &elem : islice ) {
-            //check if the ID exists
-            item *first_item = elem.first;
-            if( first_item->type->id == items_it.type->id ) {
-                //we've found the list of items with the same type ID
-
-                if( first_item->stacks_with( items_it ) ) {
-                    //add it to the existing list
-                    elem.second++;
-                    list_exists = true;
-                    break;
-                }
+        //iterate through stacked item lists of the same type
+        auto &same_type = stacks_by_type[items_it.type];
+        for( size_t i : same_type ) {
+            auto &elem = islice[i];
+            if( elem.first->stacks_with( items_it ) ) {
+                //add it to the existing list
+                elem.second++;
+                list_exists = true;
+                break;
             }
         }
 
         if( !list_exists ) {
             //insert the list into islice
+            same_type.push_back( islice.size() );
             islice.push_back( std::make_pair( &items_it, 1 ) );
         }
 
@@ -809,20 +812,20 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
         const invslice &stacks = g->u.inv.slice();
         for( size_t x = 0; x < stacks.size(); ++x ) {
             auto &an_item = stacks[x]->front();
-            advanced_inv_listitem it( &an_item, x, stacks[x]->size(), square.id, false );
-            if( is_filtered( it.it ) ) {
+            if( is_filtered( &an_item ) ) {
                 continue;
             }
+            advanced_inv_listitem it( &an_item, x, stacks[x]->size(), square.id, false );
             square.volume += it.volume;
             square.weight += it.weight;
             items.push_back( it );
         }
     } else if( square.id == AIM_WORN ) {
         for( size_t i = 0; i < g->u.worn.size(); ++i ) {
-            advanced_inv_listitem it( &g->u.worn[i], i, 1, square.id, false );
-            if( is_filtered( it.it ) ) {
+            if( is_filtered( &g->u.worn[i] ) ) {
                 continue;
             }
+            advanced_inv_listitem it( &g->u.worn[i], i, 1, square.id, false );
             square.volume += it.volume;
             square.weight += it.weight;
             items.push_back( it );
@@ -846,10 +849,10 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
                                   i_stacked( square.veh->get_items( square.vstor ) ) : 
                                   i_stacked( m.i_at( square.pos ) );
         for( size_t x = 0; x < stacks.size(); ++x ) {
-            advanced_inv_listitem it( stacks[x].first, x, stacks[x].second, square.id, is_in_vehicle );
-            if( is_filtered( it.it ) ) {
+            if( is_filtered( stacks[x].first ) ) {
                 continue;
             }
+            advanced_inv_listitem it( stacks[x].first, x, stacks[x].second, square.id, is_in_vehicle );
             square.volume += it.volume;
             square.weight += it.weight;
             items.push_back( it );
@@ -1472,8 +1475,9 @@ void advanced_inventory::display()
             recalc = true;
         } else if( action == "SORT" ) {
             if( show_sort_menu( spane ) ) {
+                // only the order of this pane changes
                 redraw = true;
-                recalc = true;
+                spane.recalc = true;
                 uistate.adv_inv_sort[src] = spane.sortby;
             }
         } else if( action == "FILTER" ) {
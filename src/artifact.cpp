@@ -1253,9 +1253,11 @@ bool save_artifacts( const std::string &path )
 
         JsonOut json( fout );
         json.start_array();
-        for( auto & p : item_controller->get_all_itypes() ) {
-            it_artifact_tool *art_tool = dynamic_cast<it_artifact_tool *>( p.second );
-            it_artifact_armor *art_armor = dynamic_cast<it_artifact_armor *>( p.second );
+        // Sorted by id, so the file does not change from one save to the next.
+        for( const auto &id : item_controller->get_all_itype_ids() ) {
+            itype *type = item_controller->find_template( id );
+            it_artifact_tool *art_tool = dynamic_cast<it_artifact_tool *>( type );
+            it_artifact_armor *art_armor = dynamic_cast<it_artifact_armor *>( type );
             if( art_tool != nullptr ) {
                 json.write( *art_tool );
             } else if( art_armor != nullptr ) {
@@ -19,6 +19,12 @@
 
 std::map<std::string, std::string> mapAutoPickupItems;
 std::vector<cPickupRules> vAutoPickupRules[5];
+// The rules of vAutoPickupRules[APU_MERGED] split at the '*', see merge_vector
+static std::vector<std::vector<std::string>> vMergedPatterns;
+
+static std::vector<std::string> split_rule(const std::string &sPattern);
+static bool auto_pickup_match_split(const std::string &sTextIn,
+                                    const std::vector<std::string> &vPattern);
 
 void show_auto_pickup()
 {
@@ -342,10 +348,10 @@ void test_pattern(int iCurrentPage, int iCurrentLine)
         return;
     }
 
-    //Loop through all itemfactory items
+    //Loop through all itemfactory items, sorted by id
     //APU now ignores prefixes, bottled items and suffix combinations still not generated
-    for( auto &p : item_controller->get_all_itypes() ) {
-        sItemName = p.second->nname(1);
+    for( const auto &id : item_controller->get_all_itype_ids() ) {
+        sItemName = item::nname( id );
         if (vAutoPickupRules[iCurrentPage][iCurrentLine].bActive &&
             auto_pickup_match(sItemName, vAutoPickupRules[iCurrentPage][iCurrentLine].sRule)) {
             vMatchingItems.push_back(sItemName);
@@ -524,6 +530,7 @@ void load_auto_pickup(bool bCharacter)
 void merge_vector()
 {
     vAutoPickupRules[APU_MERGED].clear();
+    vMergedPatterns.clear();
 
     for (unsigned i = APU_GLOBAL; i <= APU_CHARACTER; i++) { //Loop through global 1 and character 2
         for (std::vector<cPickupRules>::iterator it = vAutoPickupRules[i].begin();
@@ -531,9 +538,13 @@ void merge_vector()
             if (it->sRule != "") {
                 vAutoPickupRules[APU_MERGED].push_back(cPickupRules(it->sRule,
                                                        it->bActive, it->bExclude));
+                vMergedPatterns.push_back(split_rule(it->sRule));
             }
         }
     }
+
+    // The verdicts were made with the old rules
+    mapAutoPickupItems.clear();
 }
 
 bool hasPickupRule(std::string sRule)
@@ -573,65 +584,51 @@ void removePickupRule(std::string sRule)
     }
 }
 
+// Whether an active rule of the given kind matches the item name
+static bool match_merged_rules(const std::string &sItemName, bool bExclude)
+{
+    const auto &rules = vAutoPickupRules[APU_MERGED];
+    for( size_t i = 0; i < rules.size(); i++ ) {
+        if( rules[i].bExclude == bExclude && rules[i].bActive &&
+            auto_pickup_match_split( sItemName, vMergedPatterns[i] ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void createPickupRules(const std::string sItemNameIn)
 {
-    if (sItemNameIn == "") {
-        mapAutoPickupItems.clear();
+    if (sItemNameIn != "") {
+        // Remember the verdict even if no rule matches, so the rules are
+        // checked once per item name, not each time the item is seen
+        const bool bPickup = match_merged_rules( sItemNameIn, false ) &&
+                             !match_merged_rules( sItemNameIn, true );
+        mapAutoPickupItems[sItemNameIn] = bPickup ? "true" : "false";
+        return;
     }
 
-    std::string sItemName = "";
+    mapAutoPickupItems.clear();
 
-    //Includes only
-    for( auto &elem : vAutoPickupRules[APU_MERGED] ) {
-        if( !elem.bExclude ) {
-            if (sItemNameIn != "") {
-                if( elem.bActive && auto_pickup_match( sItemNameIn, elem.sRule ) ) {
-                    mapAutoPickupItems[sItemNameIn] = "true";
-                    break;
-                }
-            } else {
-                //Check include paterns against all itemfactory items
-                for( auto &p : item_controller->get_all_itypes() ) {
-                    sItemName = p.second->nname(1);
-                    if( elem.bActive && auto_pickup_match( sItemName, elem.sRule ) ) {
-                        mapAutoPickupItems[sItemName] = "true";
-                    }
-                }
-            }
+    //Check include paterns against all itemfactory items
+    for( auto &p : item_controller->get_all_itypes() ) {
+        const std::string sItemName = p.second->nname(1);
+        if( mapAutoPickupItems.count( sItemName ) == 0 && match_merged_rules( sItemName, false ) ) {
+            mapAutoPickupItems[sItemName] = "true";
         }
     }
 
-    //Excludes only
-    for( auto &elem : vAutoPickupRules[APU_MERGED] ) {
-        if( elem.bExclude ) {
-            if (sItemNameIn != "") {
-                if( elem.bActive && auto_pickup_match( sItemNameIn, elem.sRule ) ) {
-                    mapAutoPickupItems[sItemNameIn] = "false";
-                    return;
-                }
-            } else {
-                //Check exclude paterns against all included items
-                for (std::map<std::string, std::string>::iterator iter =
-                         mapAutoPickupItems.begin();
-                     iter != mapAutoPickupItems.end(); ++iter) {
-                    if( elem.bActive && auto_pickup_match( iter->first, elem.sRule ) ) {
-                        mapAutoPickupItems[iter->first] = "false";
-                    }
-                }
-            }
+    //Check exclude paterns against all included items
+    for( auto &elem : mapAutoPickupItems ) {
+        if( match_merged_rules( elem.first, true ) ) {
+            elem.second = "false";
         }
     }
 }
 
 bool checkExcludeRules(const std::string sItemNameIn)
 {
-    for( auto &elem : vAutoPickupRules[APU_MERGED] ) {
-        if( elem.bExclude && elem.bActive && auto_pickup_match( sItemNameIn, elem.sRule ) ) {
-            return false;
-        }
-    }
-
-    return true;
+    return !match_merged_rules( sItemNameIn, true );
 }
 
 void save_reset_changes(bool bReset)
@@ -741,6 +738,19 @@ std::string trim_rule(std::string sPattern)
 }
 
 bool auto_pickup_match(std::string sText, std::string sPattern)
+{
+    return auto_pickup_match_split( sText, split_rule( sPattern ) );
+}
+
+static std::vector<std::string> split_rule(const std::string &sPattern)
+{
+    std::vector<std::string> vPattern;
+    split(trim_rule(sPattern), '*', vPattern);
+    return vPattern;
+}
+
+static bool auto_pickup_match_split(const std::string &sTextIn,
+                                    const std::vector<std::string> &vPattern)
 {
     //case insenitive search
 
@@ -755,18 +765,14 @@ bool auto_pickup_match(std::string sText, std::string sPattern)
     *wood*hard* *x*y*z*arrow*
     */
 
-    if (sText == "") {
+    if (sTextIn == "") {
         return false;
-    } else if (sText == "*") {
+    } else if (sTextIn == "*") {
         return true;
     }
 
+    std::string sText = sTextIn;
     int iPos;
-    std::vector<std::string> vPattern;
-
-    sPattern = trim_rule(sPattern);
-
-    split(sPattern, '*', vPattern);
     size_t iNum = vPattern.size();
 
     if (iNum == 0) { //should never happen
@@ -779,7 +785,7 @@ bool auto_pickup_match(std::string sText, std::string sPattern)
         return false;
     }
 
-    for (std::vector<std::string>::iterator it = vPattern.begin();
+    for (std::vector<std::string>::const_iterator it = vPattern.begin();
          it != vPattern.end(); ++it) {
         if (it == vPattern.begin() && *it != "") { //beginning: ^vPat[i]
             if (sText.length() < it->length() ||
@@ -377,10 +377,12 @@ std::string calendar::day_of_week() const
 
 int calendar::season_length()
 {
-    if( ACTIVE_WORLD_OPTIONS.empty() || int(ACTIVE_WORLD_OPTIONS["SEASON_LENGTH"]) == 0 ) {
+    // Called for every item rot and temperature calculation.
+    static const option<int> opt_season_length( "SEASON_LENGTH", ACTIVE_WORLD_OPTIONS );
+    if( ACTIVE_WORLD_OPTIONS.empty() || opt_season_length == 0 ) {
         return 14; // default
     }
-    return int(ACTIVE_WORLD_OPTIONS["SEASON_LENGTH"]);
+    return opt_season_length;
 }
 
 void calendar::sync()
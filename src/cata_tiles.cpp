@@ -51,6 +51,7 @@ cata_tiles::cata_tiles(SDL_Renderer *render)
 {
     //ctor
     renderer = render;
+    resolved_season = -1;
 
     tile_height = 0;
     tile_width = 0;
@@ -78,10 +79,14 @@ cata_tiles::~cata_tiles()
 void cata_tiles::clear()
 {
     // release maps
-    for (tile_iterator it = tile_values.begin(); it != tile_values.end(); ++it) {
-        SDL_DestroyTexture(*it);
+    for( auto texture : tile_textures ) {
+        SDL_DestroyTexture( texture );
     }
+    tile_textures.clear();
     tile_values.clear();
+    for( auto &tiles : resolved_tiles ) {
+        tiles.clear();
+    }
     for (tile_id_iterator it = tile_ids.begin(); it != tile_ids.end(); ++it) {
         it->second = NULL;
     }
@@ -188,44 +193,76 @@ int cata_tiles::load_tileset(std::string path, int R, int G, int B)
         int sx = w / tile_width;
         int sy = h / tile_height;
 
-        sx *= tile_width;
-        sy *= tile_height;
-
-        // Set up initial source and destination information. Destination is going to be unchanging
-        SDL_Rect source_rect = {0,0,tile_width,tile_height};
-        SDL_Rect dest_rect = {0,0,tile_width,tile_height};
-
-        /** split the atlas into tiles using SDL_Rect structs instead of slicing the atlas into individual surfaces */
-        int tilecount = 0;
-        for (int y = 0; y < sy; y += tile_height) {
-            for (int x = 0; x < sx; x += tile_width) {
-                source_rect.x = x;
-                source_rect.y = y;
+        /**
+         * The atlas is loaded into as few textures as the renderer allows, each holding a
+         * block of whole tiles, so drawing neighbouring tiles rarely has to switch textures.
+         * A maximum texture size of 0 means there is no limit.
+         */
+        int block_columns = sx;
+        int block_rows = sy;
+        SDL_RendererInfo info;
+        if( SDL_GetRendererInfo( renderer, &info ) != 0 ) {
+            dbg( D_ERROR ) << "SDL_GetRendererInfo failed: " << SDL_GetError();
+        } else {
+            if( info.max_texture_width > 0 ) {
+                block_columns = std::max( 1, std::min( sx, info.max_texture_width / tile_width ) );
+            }
+            if( info.max_texture_height > 0 ) {
+                block_rows = std::max( 1, std::min( sy, info.max_texture_height / tile_height ) );
+            }
+        }
 
-                SDL_Surface *tile_surf = create_tile_surface();
-                if( tile_surf == nullptr ) {
+        std::vector<SDL_Texture *> blocks;
+        for (int by = 0; by < sy; by += block_rows) {
+            for (int bx = 0; bx < sx; bx += block_columns) {
+                const int width = std::min( block_columns, sx - bx ) * tile_width;
+                const int height = std::min( block_rows, sy - by ) * tile_height;
+                SDL_Rect source_rect = {bx * tile_width, by * tile_height, width, height};
+                SDL_Rect dest_rect = {0, 0, width, height};
+
+                SDL_Surface *block_surf = create_tile_surface( width, height );
+                if( block_surf == nullptr ) {
+                    blocks.push_back( nullptr );
                     continue;
                 }
-                if( SDL_BlitSurface( tile_atlas, &source_rect, tile_surf, &dest_rect ) != 0 ) {
+                if( SDL_BlitSurface( tile_atlas, &source_rect, block_surf, &dest_rect ) != 0 ) {
                     dbg( D_ERROR ) << "SDL_BlitSurface failed: " << SDL_GetError();
                 }
                 if (R >= 0 && R <= 255 && G >= 0 && G <= 255 && B >= 0 && B <= 255) {
-                    Uint32 key = SDL_MapRGB(tile_surf->format, 0,0,0);
-                    SDL_SetColorKey(tile_surf, SDL_TRUE, key);
-                    SDL_SetSurfaceRLE(tile_surf, true);
+                    Uint32 key = SDL_MapRGB(block_surf->format, 0,0,0);
+                    SDL_SetColorKey(block_surf, SDL_TRUE, key);
+                    SDL_SetSurfaceRLE(block_surf, true);
                 }
 
-                SDL_Texture *tile_tex = SDL_CreateTextureFromSurface(renderer,tile_surf);
-                if( tile_tex == nullptr ) {
+                SDL_Texture *block_tex = SDL_CreateTextureFromSurface(renderer,block_surf);
+                if( block_tex == nullptr ) {
                     dbg( D_ERROR) << "failed to create texture: " << SDL_GetError();
+                } else {
+                    tile_textures.push_back( block_tex );
                 }
 
-                SDL_FreeSurface(tile_surf);
+                SDL_FreeSurface(block_surf);
+                blocks.push_back( block_tex );
+            }
+        }
 
-                if( tile_tex != nullptr ) {
-                tile_values.push_back(tile_tex);
-                tilecount++;
+        /** the sprites keep the order of the tiles in the atlas, the tile ids refer to them by that */
+        const int blocks_per_row = sx > 0 ? ( sx + block_columns - 1 ) / block_columns : 0;
+        int tilecount = 0;
+        for (int y = 0; y < sy; y++) {
+            for (int x = 0; x < sx; x++) {
+                SDL_Texture *block_tex = blocks[( y / block_rows ) * blocks_per_row + x / block_columns];
+                if( block_tex == nullptr ) {
+                    continue;
                 }
+                tile_sprite sprite;
+                sprite.texture = block_tex;
+                sprite.rect.x = ( x % block_columns ) * tile_width;
+                sprite.rect.y = ( y % block_rows ) * tile_height;
+                sprite.rect.w = tile_width;
+                sprite.rect.h = tile_height;
+                tile_values.push_back( sprite );
+                tilecount++;
             }
         }
 
@@ -601,23 +638,40 @@ void cata_tiles::draw( int destx, int desty, const tripoint &center, int width,
     screentile_width = (width + tile_width - 1) / tile_width;
     screentile_height = (height + tile_height - 1) / tile_height;
 
-    // in isometric mode, render the whole reality bubble
-    // TODO: make this smarter
-    const int min_x = tile_iso ? MAPSIZE*SEEX : o_x;
-    const int max_x = tile_iso ? 0 : sx + o_x;
-    const int dx = tile_iso ? -1 : 1; // iso mode renders right to left, for overlap reasons
-    const int min_y = tile_iso ? 0 : o_y;
-    const int max_y = tile_iso ? MAPSIZE*SEEX : sy + o_y;
-    const int dy = 1;
+    // In isometric mode the tile at (x, y) is drawn (u * tile_width / 2, v * tile_width / 4)
+    // away from the top left of the window (shifted down by half the window), with
+    // u = (x - o_x) + (y - o_y) and v = (y - o_y) - (x - o_x), and covers tile_width x
+    // tile_height pixels from there. Only the tiles whose u and v put them (partly) into
+    // the window are drawn, the bounds are a tile wider than needed to cover rounding.
+    const int map_width = MAPSIZE * SEEX;
+    const int map_height = MAPSIZE * SEEY;
+    const int iso_center_y = screentile_height * tile_height / 2;
+    const int min_u = -2;
+    const int max_u = 2 * width / tile_width + 1;
+    const int min_v = floor( -( iso_center_y + tile_height ) * 4.0 / tile_width ) - 1;
+    const int max_v = ceil( ( height - iso_center_y ) * 4.0 / tile_width ) + 1;
+
+    const int min_y = tile_iso ? std::max( 0, o_y + ( min_u + min_v ) / 2 - 1 ) : o_y;
+    const int max_y = tile_iso ? std::min( map_height, o_y + ( max_u + max_v ) / 2 + 2 ) : sy + o_y;
 
     tripoint temp;
     temp.z = center.z;
     int &x = temp.x;
     int &y = temp.y;
     auto &ch = g->m.access_cache( temp.z );
-    for( y = min_y; y * dy < max_y * dy; y += dy) {
-        for( x = min_x; x * dx < max_x * dx; x += dx) {
-            draw_single_tile( temp, ch.visibility_cache[x][y], cache );
+    for( y = min_y; y < max_y; y++ ) {
+        if( tile_iso ) {
+            const int rel_y = y - o_y;
+            const int min_x = std::max( 0, o_x + std::max( min_u - rel_y, rel_y - max_v ) );
+            const int max_x = std::min( map_width - 1, o_x + std::min( max_u - rel_y, rel_y - min_v ) );
+            // iso mode renders right to left, for overlap reasons
+            for( x = max_x; x >= min_x; x-- ) {
+                draw_single_tile( temp, ch.visibility_cache[x][y], cache );
+            }
+        } else {
+            for( x = o_x; x < sx + o_x; x++ ) {
+                draw_single_tile( temp, ch.visibility_cache[x][y], cache );
+            }
         }
     }
 
@@ -697,17 +751,85 @@ bool cata_tiles::draw_from_id_string(std::string id, TILE_CATEGORY category,
         return false;
     }
 
+    const resolved_tile &found = find_tile( id, category, subcategory );
+    //  this really shouldn't happen, but the tileset creator might have forgotten to define an unknown tile
+    if( found.tile == nullptr ) {
+        return false;
+    }
+    if( found.no_rotation ) {
+        rota = 0;
+        subtile = -1;
+    }
+
+    tile_type *display_tile = found.tile;
+    // check to see if the display_tile is multitile, and if so if it has the key related to subtile
+    if (subtile != -1 && display_tile->multitile) {
+        auto const &display_subtiles = display_tile->available_subtiles;
+        auto const end = std::end(display_subtiles);
+        if (std::find(begin(display_subtiles), end, multitile_keys[subtile]) != end) {
+            // append subtile name to tile and re-find display_tile
+            return draw_from_id_string(found.id + "_" + multitile_keys[subtile], x, y, -1, rota);
+        }
+    }
+
+    // make sure we aren't going to rotate the tile if it shouldn't be rotated
+    if (!display_tile->rotates) {
+        rota = 0;
+    }
+
+    // translate from player-relative to screen relative tile position
+    int screen_x, screen_y;
+    if (tile_iso) {
+        screen_x = ((x-o_x) - (o_y-y)) * tile_width / 2 +
+            op_x;
+        // y uses tile_width because width is definitive for iso tiles
+        // tile footprints are half as tall as wide, aribtrarily tall
+        screen_y = ((y-o_y) - (x-o_x)) * tile_width / 4 +
+            screentile_height * tile_height / 2 + // TODO: more obvious centering math
+            op_y;
+    } else {
+        screen_x = (x - o_x) * tile_width + op_x;
+        screen_y = (y - o_y) * tile_height + op_y;
+    }
+
+    //draw it!
+    draw_tile_at(display_tile, screen_x, screen_y, rota);
+
+    return true;
+}
+
+const cata_tiles::resolved_tile &cata_tiles::find_tile( const std::string &id,
+        TILE_CATEGORY category, const std::string &subcategory )
+{
+    // The tiles found depend on the season, drop them when it changes.
+    const int season = calendar::turn.get_season();
+    if( season != resolved_season ) {
+        for( auto &tiles : resolved_tiles ) {
+            tiles.clear();
+        }
+        resolved_season = season;
+    }
+
+    // Most ids come without a subcategory, don't build a key for them.
+    auto &tiles = resolved_tiles[category];
+    const auto cached = subcategory.empty() ? tiles.find( id ) : tiles.find( id + '\n' + subcategory );
+    if( cached != tiles.end() ) {
+        return cached->second;
+    }
+    resolved_tile &result = tiles[subcategory.empty() ? id : id + '\n' + subcategory];
+    result.id = id;
+
     constexpr size_t suffix_len = 15;
     constexpr char season_suffix[4][suffix_len] = {
         "_season_spring", "_season_summer", "_season_autumn", "_season_winter"};
-   
-    std::string seasonal_id = id + season_suffix[calendar::turn.get_season()];
+
+    std::string seasonal_id = id + season_suffix[season];
 
     tile_id_iterator it = tile_ids.find(seasonal_id);
     if (it == tile_ids.end()) {
         it = tile_ids.find(id);
     } else {
-        id = std::move(seasonal_id);
+        result.id = std::move(seasonal_id);
     }
 
     if (it == tile_ids.end()) {
@@ -740,8 +862,7 @@ bool cata_tiles::draw_from_id_string(std::string id, TILE_CATEGORY category,
                 sym = v.sym;
                 if (!subcategory.empty()) {
                     sym = special_symbol(subcategory[0]);
-                    rota = 0;
-                    subtile = -1;
+                    result.no_rotation = true;
                 }
                 col = v.color;
             }
@@ -785,20 +906,22 @@ bool cata_tiles::draw_from_id_string(std::string id, TILE_CATEGORY category,
             const bool isBold = col & A_BOLD;
             const int FG = colorpair.FG + (isBold ? 8 : 0);
 //            const int BG = colorpair.BG;
-            // static so it does not need to be allocated every time,
             // see load_ascii_set for the meaning
-            static std::string generic_id("ASCII_XFG");
+            std::string generic_id("ASCII_XFG");
             generic_id[6] = static_cast<char>(sym);
             generic_id[7] = static_cast<char>(FG);
             generic_id[8] = static_cast<char>(-1);
-            if (tile_ids.count(generic_id) > 0) {
-                return draw_from_id_string(generic_id, x, y, subtile, rota);
+            if (tile_ids.count(generic_id) == 0) {
+                // Try again without color this time (using default color).
+                generic_id[7] = static_cast<char>(-1);
+                generic_id[8] = static_cast<char>(-1);
             }
-            // Try again without color this time (using default color).
-            generic_id[7] = static_cast<char>(-1);
-            generic_id[8] = static_cast<char>(-1);
             if (tile_ids.count(generic_id) > 0) {
-                return draw_from_id_string(generic_id, x, y, subtile, rota);
+                // The symbol is drawn like any other tile, seasons and multitiles included.
+                const resolved_tile &generic = find_tile( generic_id, C_NONE, empty_string );
+                result.tile = generic.tile;
+                result.id = generic.id;
+                return result;
             }
         }
     }
@@ -824,47 +947,10 @@ bool cata_tiles::draw_from_id_string(std::string id, TILE_CATEGORY category,
         it = tile_ids.find("unknown");
     }
 
-    //  this really shouldn't happen, but the tileset creator might have forgotten to define an unknown tile
-    if (it == tile_ids.end()) {
-        return false;
-    }
-
-    tile_type *display_tile = it->second;
-    // check to see if the display_tile is multitile, and if so if it has the key related to subtile
-    if (subtile != -1 && display_tile->multitile) {
-        auto const &display_subtiles = display_tile->available_subtiles;
-        auto const end = std::end(display_subtiles);
-        if (std::find(begin(display_subtiles), end, multitile_keys[subtile]) != end) {
-            // append subtile name to tile and re-find display_tile
-            return draw_from_id_string(
-                std::move(id.append("_", 1).append(multitile_keys[subtile])),x, y, -1, rota);
-        }
-    }
-
-    // make sure we aren't going to rotate the tile if it shouldn't be rotated
-    if (!display_tile->rotates) {
-        rota = 0;
+    if (it != tile_ids.end()) {
+        result.tile = it->second;
     }
-
-    // translate from player-relative to screen relative tile position
-    int screen_x, screen_y;
-    if (tile_iso) {
-        screen_x = ((x-o_x) - (o_y-y)) * tile_width / 2 +
-            op_x;
-        // y uses tile_width because width is definitive for iso tiles
-        // tile footprints are half as tall as wide, aribtrarily tall
-        screen_y = ((y-o_y) - (x-o_x)) * tile_width / 4 +
-            screentile_height * tile_height / 2 + // TODO: more obvious centering math
-            op_y;
-    } else {
-        screen_x = (x - o_x) * tile_width + op_x;
-        screen_y = (y - o_y) * tile_height + op_y;
-    }
-
-    //draw it!
-    draw_tile_at(display_tile, screen_x, screen_y, rota);
-
-    return true;
+    return result;
 }
 
 bool cata_tiles::draw_sprite_at(std::vector<int>& spritelist, int x, int y, int rota) {
@@ -893,35 +979,36 @@ bool cata_tiles::draw_sprite_at(std::vector<int>& spritelist, int x, int y, int
             sprite_num = rota % spritelist.size();
         }
 
-        SDL_Texture *sprite_tex = tile_values[spritelist[sprite_num]];
+        const tile_sprite &sprite = tile_values[spritelist[sprite_num]];
+        SDL_Texture *sprite_tex = sprite.texture;
         if ( rotate_sprite ) {
             switch ( rota ) {
                 default:
                 case 0: // unrotated (and 180, with just two sprites)
-                    ret = SDL_RenderCopyEx( renderer, sprite_tex, NULL, &destination,
+                    ret = SDL_RenderCopyEx( renderer, sprite_tex, &sprite.rect, &destination,
                         0, NULL, SDL_FLIP_NONE );
                     break;
                 case 1: // 90 degrees (and 270, with just two sprites)
 #if (defined _WIN32 || defined WINDOWS)
                     destination.y -= 1;
 #endif
-                    ret = SDL_RenderCopyEx( renderer, sprite_tex, NULL, &destination,
+                    ret = SDL_RenderCopyEx( renderer, sprite_tex, &sprite.rect, &destination,
                         -90, NULL, SDL_FLIP_NONE );
                     break;
                 case 2: // 180 degrees, implemented with flips instead of rotation
-                    ret = SDL_RenderCopyEx( renderer, sprite_tex, NULL, &destination,
+                    ret = SDL_RenderCopyEx( renderer, sprite_tex, &sprite.rect, &destination,
                         0, NULL, static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
                     break;
                 case 3: // 270 degrees
 #if (defined _WIN32 || defined WINDOWS)
                     destination.x -= 1;
 #endif
-                    ret = SDL_RenderCopyEx( renderer, sprite_tex, NULL, &destination,
+                    ret = SDL_RenderCopyEx( renderer, sprite_tex, &sprite.rect, &destination,
                         90, NULL, SDL_FLIP_NONE );
                     break;
             }
         } else { // don't rotate, same as case 0 above
-            ret = SDL_RenderCopyEx( renderer, sprite_tex, NULL, &destination,
+            ret = SDL_RenderCopyEx( renderer, sprite_tex, &sprite.rect, &destination,
                 0, NULL, SDL_FLIP_NONE );
         }
 
@@ -1240,12 +1327,17 @@ bool cata_tiles::draw_item_highlight(int x, int y)
 }
 
 SDL_Surface *cata_tiles::create_tile_surface()
+{
+    return create_tile_surface( tile_width, tile_height );
+}
+
+SDL_Surface *cata_tiles::create_tile_surface( const int width, const int height )
 {
     SDL_Surface *surface;
     #if SDL_BYTEORDER == SDL_BIG_ENDIAN
-        surface = SDL_CreateRGBSurface(0, tile_width, tile_height, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+        surface = SDL_CreateRGBSurface(0, width, height, 32, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
     #else
-        surface = SDL_CreateRGBSurface(0, tile_width, tile_height, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
+        surface = SDL_CreateRGBSurface(0, width, height, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
     #endif
     if( surface == nullptr ) {
         dbg( D_ERROR ) << "Failed to create surface: " << SDL_GetError();
@@ -1272,10 +1364,21 @@ void cata_tiles::create_default_item_highlight()
     SDL_FreeSurface(surface);
 
     if( texture != nullptr ) {
-    tile_values.push_back(texture);
+    tile_sprite sprite;
+    sprite.texture = texture;
+    sprite.rect.x = 0;
+    sprite.rect.y = 0;
+    sprite.rect.w = tile_width;
+    sprite.rect.h = tile_height;
+    tile_textures.push_back(texture);
+    tile_values.push_back(sprite);
     tile_type *type = new tile_type;
     type->fg.push_back(index);
     tile_ids[key] = type;
+    // the highlight might have been looked up (and not found) before
+    for( auto &tiles : resolved_tiles ) {
+        tiles.clear();
+    }
     }
 }
 
@@ -16,6 +16,7 @@
 #include "enums.h"
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
@@ -87,8 +88,14 @@ enum TILE_CATEGORY
     C_WEATHER,
 };
 
+/** A sprite of the tileset: an area of one of the textures the tileset image was loaded into */
+struct tile_sprite {
+    SDL_Texture *texture;
+    SDL_Rect rect;
+};
+
 /** Typedefs */
-typedef std::vector<SDL_Texture *> tile_map;
+typedef std::vector<tile_sprite> tile_map;
 typedef std::unordered_map<std::string, tile_type *> tile_id_map;
 
 typedef tile_map::iterator tile_iterator;
@@ -198,6 +205,20 @@ class cata_tiles
         bool draw_from_id_string(std::string id, TILE_CATEGORY category,
                                  const std::string &subcategory, int x, int y, int subtile, int rota);
         bool draw_sprite_at(std::vector<int>& spritelist, int x, int y, int rota);
+
+        /**
+         * The tile that draw_from_id_string ends up drawing for an id: the tile itself
+         * (NULL if there is none, not even "unknown"), the id the tile was found under
+         * (its multitile variants are looked up with it) and whether the id fell back to
+         * the symbol of a vehicle part, which is never rotated.
+         */
+        struct resolved_tile {
+            tile_type *tile = nullptr;
+            std::string id;
+            bool no_rotation = false;
+        };
+        const resolved_tile &find_tile( const std::string &id, TILE_CATEGORY category,
+                                        const std::string &subcategory );
         bool draw_tile_at(tile_type *tile, int x, int y, int rota);
 
         /**
@@ -207,6 +228,7 @@ class cata_tiles
 
         /** Surface/Sprite rotation specifics */
         SDL_Surface *create_tile_surface();
+        SDL_Surface *create_tile_surface( int width, int height );
 
         /* Tile Picking */
         void get_tile_values(const int t, const int *tn, int &subtile, int &rotation);
@@ -292,7 +314,13 @@ class cata_tiles
         /** Variables */
         SDL_Renderer *renderer;
         tile_map tile_values;
+        // The textures the sprites in tile_values are areas of.
+        std::vector<SDL_Texture *> tile_textures;
         tile_id_map tile_ids;
+        // Tiles found by find_tile, by category and by id (and subcategory), they depend
+        // on the season they were found in.
+        std::unordered_map<std::string, resolved_tile> resolved_tiles[C_WEATHER + 1];
+        int resolved_season;
 
         int tile_height, tile_width, default_tile_width, default_tile_height;
         // The width and height of the area we can draw in,
@@ -34,6 +34,8 @@ std::vector<std::string> craft_cat_list;
 std::map<std::string, std::vector<std::string> > craft_subcat_list;
 std::map<std::string, std::vector<recipe *>> recipes;
 std::map<itype_id, std::vector<recipe *>> recipes_by_component;
+// Like recipes_by_component, for the tools, used to search recipes by tool.
+static std::map<itype_id, std::vector<recipe *>> recipes_by_tool;
 
 static void draw_recipe_tabs(WINDOW *w, std::string tab, TAB_MODE mode = NORMAL);
 static void draw_recipe_subtabs(WINDOW *w, std::string tab, std::string subtab,
@@ -259,6 +261,7 @@ void load_recipe(JsonObject &jsobj)
 void reset_recipes()
 {
     recipes_by_component.clear();
+    recipes_by_tool.clear();
     for( auto &recipe : recipes ) {
         for( auto &elem : recipe.second ) {
             delete elem;
@@ -292,6 +295,15 @@ void finalize_recipes()
                 t->book->recipes.insert( rwd );
             }
             r->booksets.clear();
+
+            std::unordered_set<itype_id> counted;
+            for( const auto &tool_choices : r->requirements.tools ) {
+                for( const tool_comp &tool : tool_choices ) {
+                    if( counted.insert( tool.type ).second ) {
+                        recipes_by_tool[tool.type].push_back( r );
+                    }
+                }
+            }
         }
     }
 }
@@ -602,6 +614,7 @@ const recipe *select_crafting_recipe( int &batch_size )
     ctxt.register_action("CYCLE_BATCH");
 
     const inventory &crafting_inv = g->u.crafting_inventory();
+    recipe_availability availability( crafting_inv );
     std::string filterstring = "";
     do {
         if (redraw) {
@@ -626,7 +639,7 @@ const recipe *select_crafting_recipe( int &batch_size )
                 batch_recipes(crafting_inv, current, available, chosen);
             } else {
                 // Set current to all recipes in the current tab; available are possible to make
-                pick_recipes(crafting_inv, current, available, tab, subtab, filterstring);
+                pick_recipes(availability, current, available, tab, subtab, filterstring);
             }
         }
 
@@ -1161,6 +1174,9 @@ const inventory& player::crafting_inventory()
         tools.charges = power_level;
         cached_crafting_inventory += tools;
     }
+    // The requirement checks of every recipe in the crafting menu ask this inventory.
+    cached_crafting_inventory.cache_totals();
+
     cached_moves = moves;
     cached_turn = calendar::turn.get_turn();
     cached_position = pos3();
@@ -1201,17 +1217,36 @@ int recipe::print_time(WINDOW *w, int ypos, int xpos, int width,
 // ui.cpp
 extern bool lcmatch(const std::string &str, const std::string &findstr);
 
-template<typename T>
-bool lcmatch_any(const std::vector< std::vector<T> > &list_of_list, const std::string &filter)
+// The recipes that use an item whose name matches the filter, looks at each item once
+// instead of at each recipe using it.
+static std::unordered_set<const recipe *> recipes_using_match(
+    const std::map<itype_id, std::vector<recipe *>> &lookup, const std::string &filter )
 {
-    for( auto &list : list_of_list ) {
-        for( auto &comp : list ) {
-            if( lcmatch( item::nname( comp.type ), filter ) ) {
-                return true;
-            }
+    std::unordered_set<const recipe *> result;
+    for( auto &elem : lookup ) {
+        if( lcmatch( item::nname( elem.first ), filter ) ) {
+            result.insert( elem.second.begin(), elem.second.end() );
         }
     }
-    return false;
+    return result;
+}
+
+bool recipe_availability::is_known( const recipe *r )
+{
+    auto iter = known.find( r );
+    if( iter == known.end() ) {
+        iter = known.emplace( r, g->u.knows_recipe( r ) || g->u.has_recipe( r, crafting_inv ) != -1 ).first;
+    }
+    return iter->second;
+}
+
+bool recipe_availability::can_make( const recipe *r )
+{
+    auto iter = makeable.find( r );
+    if( iter == makeable.end() ) {
+        iter = makeable.emplace( r, r->can_make_with_inventory( crafting_inv ) ).first;
+    }
+    return iter->second;
 }
 
 void batch_recipes(const inventory &crafting_inv,
@@ -1262,7 +1297,7 @@ int recipe::batch_time(int batch) const
     return (int)total_time;
 }
 
-void pick_recipes(const inventory &crafting_inv,
+void pick_recipes(recipe_availability &availability,
                   std::vector<const recipe *> &current,
                   std::vector<bool> &available, std::string tab,
                   std::string subtab, std::string filter)
@@ -1295,6 +1330,8 @@ void pick_recipes(const inventory &crafting_inv,
         filter = filter.substr(pos + 1);
     }
     std::vector<recipe *> available_recipes;
+    std::unordered_set<const recipe *> tool_matches;
+    std::unordered_set<const recipe *> component_matches;
 
     if (filter == "") {
         available_recipes = recipes[tab];
@@ -1302,23 +1339,29 @@ void pick_recipes(const inventory &crafting_inv,
         // lcmatch needs an all lowercase string to match case-insensitive
         std::transform( filter.begin(), filter.end(), filter.begin(), tolower );
 
-        for( auto &recipe : recipes ) {
-            available_recipes.insert( available_recipes.begin(), recipe.second.begin(),
-                                      recipe.second.end() );
+        // Later categories first, as this list has always been sorted.
+        for( auto recipe = recipes.rbegin(); recipe != recipes.rend(); ++recipe ) {
+            available_recipes.insert( available_recipes.end(), recipe->second.begin(),
+                                      recipe->second.end() );
+        }
+        if( search_tool ) {
+            tool_matches = recipes_using_match( recipes_by_tool, filter );
+        }
+        if( search_component ) {
+            component_matches = recipes_using_match( recipes_by_component, filter );
         }
     }
 
     current.clear();
     available.clear();
     std::vector<const recipe *> filtered_list;
-    int max_difficulty = 0;
 
     for( auto rec : available_recipes ) {
 
         if( subtab == "CSC_ALL" || rec->subcat == subtab ||
             (rec->subcat == "" && last_craft_subcat( tab ) == subtab) ||
             filter != "") {
-            if( !g->u.knows_recipe(rec) && -1 == g->u.has_recipe(rec, crafting_inv) ) {
+            if( !availability.is_known( rec ) ) {
                 continue;
             }
 
@@ -1346,12 +1389,12 @@ void pick_recipes(const inventory &crafting_inv,
                   }
                 }
                 if(search_tool) {
-                    if( !lcmatch_any( rec->requirements.tools, filter ) ) {
+                    if( tool_matches.count( rec ) == 0 ) {
                         continue;
                     }
                 }
                 if(search_component) {
-                    if( !lcmatch_any( rec->requirements.components, filter ) ) {
+                    if( component_matches.count( rec ) == 0 ) {
                         continue;
                     }
                 }
@@ -1375,27 +1418,24 @@ void pick_recipes(const inventory &crafting_inv,
             filtered_list.push_back(rec);
 
         }
-        max_difficulty = std::max(max_difficulty, rec->difficulty);
     }
 
-    int truecount = 0;
-    for( int i = max_difficulty; i != -1; --i ) {
-        for( auto rec : filtered_list ) {
-
-            if (rec->difficulty == i) {
-                if (rec->can_make_with_inventory(crafting_inv)) {
-                    current.insert(current.begin(), rec);
-                    available.insert(available.begin(), true);
-                    truecount++;
-                } else {
-                    current.push_back(rec);
-                    available.push_back(false);
-                }
-            }
+    // Recipes that can be made first, each part ordered by descending difficulty.
+    std::stable_sort( filtered_list.begin(), filtered_list.end(),
+    []( const recipe * a, const recipe * b ) {
+        return a->difficulty > b->difficulty;
+    } );
+    std::vector<const recipe *> unavailable;
+    for( auto rec : filtered_list ) {
+        if( availability.can_make( rec ) ) {
+            current.push_back( rec );
+        } else {
+            unavailable.push_back( rec );
         }
     }
-    // This is so the list of available recipes is also is order of difficulty.
-    std::reverse(current.begin(), current.begin() + truecount);
+    available.assign( current.size(), true );
+    current.insert( current.end(), unavailable.begin(), unavailable.end() );
+    available.resize( current.size(), false );
 }
 
 void player::make_craft(const std::string &id_to_make, int batch_size)
@@ -10,6 +10,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <unordered_map>
 
 class JsonObject;
 class Skill;
@@ -129,7 +130,27 @@ void finalize_recipes();
 // Returns false if the player answered no to the query.
 bool query_dissamble(const item &dis_item);
 const recipe *select_crafting_recipe(int &batch_size);
-void pick_recipes(const inventory &crafting_inv,
+/**
+ * Remembers which recipes the player can use and make with one crafting inventory.
+ * The crafting menu keeps it while it's open (the inventory doesn't change meanwhile),
+ * so switching tabs or changing the filter only checks recipes not seen before.
+ */
+class recipe_availability
+{
+    public:
+        recipe_availability( const inventory &crafting_inv ) : crafting_inv( crafting_inv ) {}
+
+        // Known to the player or in a book nearby.
+        bool is_known( const recipe *r );
+        bool can_make( const recipe *r );
+
+    private:
+        const inventory &crafting_inv;
+        std::unordered_map<const recipe *, bool> known;
+        std::unordered_map<const recipe *, bool> makeable;
+};
+
+void pick_recipes(recipe_availability &availability,
                   std::vector<const recipe *> &current,
                   std::vector<bool> &available, std::string tab,
                   std::string subtab, std::string filter);
@@ -16,6 +16,9 @@
 #include <cmath>
 #include <map>
 
+static const effect_type_handle effect_sleep( "sleep" );
+static const effect_type_handle effect_lying_down( "lying_down" );
+
 static std::map<int, std::map<body_part, double> > default_hit_weights = {
     {
         -1, /* attacker smaller */
@@ -271,6 +274,12 @@ bool Creature::sees( const tripoint &t ) const
     return sees( t, junk1, junk2 );
 }
 
+int Creature::max_sight_distance() const
+{
+    // See sees( const tripoint & ), the current light never extends the daylight range.
+    return std::max( 1, sight_range( DAYLIGHT_LEVEL ) );
+}
+
 // Helper function to check if potential area of effect of a weapon overlaps vehicle
 // Maybe TODO: If this is too slow, precalculate a bounding box and clip the tested area to it
 bool overlaps_vehicle( const std::set<tripoint> &veh_area, const tripoint &pos, const int area )
@@ -795,68 +804,65 @@ void Creature::add_effect( efftype_id eff_id, int dur, body_part bp,
         return;
     }
 
+    // Make sure it's a valid effect, without adding an empty type for it
+    const auto type = effect_types.find( eff_id );
+    if( type == effect_types.end() ) {
+        return;
+    }
+
     // Mutate to a main (HP'd) body_part if necessary.
-    if (effect_types[eff_id].get_main_parts()) {
+    if( type->second.get_main_parts() ) {
         bp = mutate_to_main_part(bp);
     }
 
     bool found = false;
     // Check if we already have it
-    auto matching_map = effects.find(eff_id);
-    if (matching_map != effects.end()) {
-        auto found_effect = effects[eff_id].find(bp);
-        if (found_effect != effects[eff_id].end()) {
-            found = true;
-            effect &e = found_effect->second;
-            // If we do, mod the duration, factoring in the mod value
-            e.mod_duration(dur * e.get_dur_add_perc() / 100);
-            // Limit to max duration
-            if (e.get_max_duration() > 0 && e.get_duration() > e.get_max_duration()) {
-                e.set_duration(e.get_max_duration());
-            }
-            // Adding a permanent effect makes it permanent
-            if( e.is_permanent() ) {
-                e.pause_effect();
-            }
-            // Set intensity if value is given
-            if (intensity > 0) {
-                e.set_intensity(intensity);
-            // Else intensity uses the type'd step size if it already exists
-            } else if (e.get_int_add_val() != 0) {
-                e.mod_intensity(e.get_int_add_val());
-            }
+    effect *const found_effect = find_effect( eff_id, bp );
+    if( found_effect != nullptr ) {
+        found = true;
+        effect &e = *found_effect;
+        // If we do, mod the duration, factoring in the mod value
+        e.mod_duration(dur * e.get_dur_add_perc() / 100);
+        // Limit to max duration
+        if (e.get_max_duration() > 0 && e.get_duration() > e.get_max_duration()) {
+            e.set_duration(e.get_max_duration());
+        }
+        // Adding a permanent effect makes it permanent
+        if( e.is_permanent() ) {
+            e.pause_effect();
+        }
+        // Set intensity if value is given
+        if (intensity > 0) {
+            e.set_intensity(intensity);
+        // Else intensity uses the type'd step size if it already exists
+        } else if (e.get_int_add_val() != 0) {
+            e.mod_intensity(e.get_int_add_val());
+        }
 
-            // Bound intensity by [1, max intensity]
-            if (e.get_intensity() < 1) {
-                add_msg( m_debug, "Bad intensity, ID: %s", e.get_id().c_str() );
-                e.set_intensity(1);
-            } else if (e.get_intensity() > e.get_max_intensity()) {
-                e.set_intensity(e.get_max_intensity());
-            }
+        // Bound intensity by [1, max intensity]
+        if (e.get_intensity() < 1) {
+            add_msg( m_debug, "Bad intensity, ID: %s", e.get_id().c_str() );
+            e.set_intensity(1);
+        } else if (e.get_intensity() > e.get_max_intensity()) {
+            e.set_intensity(e.get_max_intensity());
         }
     }
 
     if( found == false ) {
         // If we don't already have it then add a new one
 
-        // First make sure it's a valid effect
-        if (effect_types.find(eff_id) == effect_types.end()) {
-            return;
-        }
-        // Then check if the effect is blocked by another
+        // Check if the effect is blocked by another
         for( auto &elem : effects ) {
-            for( auto &_effect_it : elem.second ) {
-                for( const auto blocked_effect : _effect_it.second.get_blocks_effects() ) {
-                    if (blocked_effect == eff_id) {
-                        // The effect is blocked by another, return
-                        return;
-                    }
+            for( const auto blocked_effect : elem.second.get_blocks_effects() ) {
+                if (blocked_effect == eff_id) {
+                    // The effect is blocked by another, return
+                    return;
                 }
             }
         }
 
         // Now we can make the new effect for application
-        effect new_eff(&effect_types[eff_id], dur, bp, permanent, intensity);
+        effect new_eff(&type->second, dur, bp, permanent, intensity);
         effect &e = new_eff;
         // Bound to max duration
         if (e.get_max_duration() > 0 && e.get_duration() > e.get_max_duration()) {
@@ -869,7 +875,7 @@ void Creature::add_effect( efftype_id eff_id, int dur, body_part bp,
         } else if (new_eff.get_intensity() > new_eff.get_max_intensity()) {
             new_eff.set_intensity(new_eff.get_max_intensity());
         }
-        effects[eff_id][bp] = new_eff;
+        effects[new_eff.get_key()] = new_eff;
         if (is_player()) {
             // Only print the message if we didn't already have it
             if(effect_types[eff_id].get_apply_message() != "") {
@@ -906,7 +912,7 @@ void Creature::clear_effects()
 {
     effects.clear();
 }
-bool Creature::remove_effect(efftype_id eff_id, body_part bp)
+bool Creature::remove_effect(const efftype_id &eff_id, body_part bp)
 {
     if (!has_effect(eff_id, bp)) {
         //Effect doesn't exist, so do nothing
@@ -925,60 +931,73 @@ bool Creature::remove_effect(efftype_id eff_id, body_part bp)
                                        effect_types[eff_id].get_remove_memorial_log().c_str()));
     }
 
-    // num_bp means remove all of a given effect id
-    if (bp == num_bp) {
-        effects.erase(eff_id);
+    const int loadid = effect_type_loadid( eff_id );
+    if( bp == num_bp ) {
+        // num_bp means remove all of a given effect id
+        effects.erase( effects.lower_bound( std::make_pair( loadid, bp_torso ) ),
+                       effects.lower_bound( std::make_pair( loadid + 1, bp_torso ) ) );
     } else {
-        effects[eff_id].erase(bp);
-        // If there are no more effects of a given type remove the type map
-        if (effects[eff_id].empty()) {
-            effects.erase(eff_id);
-        }
+        effects.erase( std::make_pair( loadid, bp ) );
     }
     return true;
 }
-bool Creature::has_effect(efftype_id eff_id, body_part bp) const
+effect *Creature::find_effect( const efftype_id &eff_id, body_part bp )
+{
+    return effects.empty() ? nullptr : find_effect( effect_type_loadid( eff_id ), bp );
+}
+const effect *Creature::find_effect( const efftype_id &eff_id, body_part bp ) const
+{
+    return effects.empty() ? nullptr : find_effect( effect_type_loadid( eff_id ), bp );
+}
+effect *Creature::find_effect( const int_id<effect_type> eff, body_part bp )
+{
+    const auto it = effects.find( std::make_pair( eff.to_i(), bp ) );
+    return it != effects.end() ? &it->second : nullptr;
+}
+const effect *Creature::find_effect( const int_id<effect_type> eff, body_part bp ) const
+{
+    const auto it = effects.find( std::make_pair( eff.to_i(), bp ) );
+    return it != effects.end() ? &it->second : nullptr;
+}
+bool Creature::has_effect(const efftype_id &eff_id, body_part bp) const
+{
+    return !effects.empty() && has_effect( effect_type_loadid( eff_id ), bp );
+}
+bool Creature::has_effect( const int_id<effect_type> eff, body_part bp ) const
 {
     // num_bp means anything targeted or not
     if (bp == num_bp) {
-        return effects.find( eff_id ) != effects.end();
+        // Effects are sorted by type first, so all effects of this type are adjacent.
+        const auto it = effects.lower_bound( std::make_pair( eff.to_i(), bp_torso ) );
+        return it != effects.end() && it->first.first == eff.to_i();
     } else {
-        auto got_outer = effects.find(eff_id);
-        if(got_outer != effects.end()) {
-            auto got_inner = got_outer->second.find(bp);
-            if (got_inner != got_outer->second.end()) {
-                return true;
-            }
-        }
-        return false;
+        return find_effect( eff, bp ) != nullptr;
     }
 }
-effect Creature::get_effect(efftype_id eff_id, body_part bp) const
+effect Creature::get_effect(const efftype_id &eff_id, body_part bp) const
 {
-    auto got_outer = effects.find(eff_id);
-    if(got_outer != effects.end()) {
-        auto got_inner = got_outer->second.find(bp);
-        if (got_inner != got_outer->second.end()) {
-            return got_inner->second;
-        }
-    }
-    return effect();
+    const effect *const e = find_effect( eff_id, bp );
+    return e != nullptr ? *e : effect();
 }
-int Creature::get_effect_dur(efftype_id eff_id, body_part bp) const
+int Creature::get_effect_dur(const efftype_id &eff_id, body_part bp) const
 {
-    if(has_effect(eff_id, bp)) {
-        effect tmp = get_effect(eff_id, bp);
-        return tmp.get_duration();
-    }
-    return 0;
+    const effect *const e = find_effect( eff_id, bp );
+    return e != nullptr ? e->get_duration() : 0;
 }
-int Creature::get_effect_int(efftype_id eff_id, body_part bp) const
+int Creature::get_effect_dur( const int_id<effect_type> eff, body_part bp ) const
 {
-    if(has_effect(eff_id, bp)) {
-        effect tmp = get_effect(eff_id, bp);
-        return tmp.get_intensity();
-    }
-    return 0;
+    const effect *const e = find_effect( eff, bp );
+    return e != nullptr ? e->get_duration() : 0;
+}
+int Creature::get_effect_int(const efftype_id &eff_id, body_part bp) const
+{
+    const effect *const e = find_effect( eff_id, bp );
+    return e != nullptr ? e->get_intensity() : 0;
+}
+int Creature::get_effect_int( const int_id<effect_type> eff, body_part bp ) const
+{
+    const effect *const e = find_effect( eff, bp );
+    return e != nullptr ? e->get_intensity() : 0;
 }
 void Creature::process_effects()
 {
@@ -990,15 +1009,13 @@ void Creature::process_effects()
 
     // Decay/removal of effects
     for( auto &elem : effects ) {
-        for( auto &_it : elem.second ) {
-            // Add any effects that others remove to the removal list
-            for( const auto removed_effect : _it.second.get_removes_effects() ) {
-                rem_ids.push_back( removed_effect );
-                rem_bps.push_back(num_bp);
-            }
-            // Run decay effects, marking effects for removal as necessary.
-            _it.second.decay( rem_ids, rem_bps, calendar::turn, is_player() );
+        // Add any effects that others remove to the removal list
+        for( const auto removed_effect : elem.second.get_removes_effects() ) {
+            rem_ids.push_back( removed_effect );
+            rem_bps.push_back(num_bp);
         }
+        // Run decay effects, marking effects for removal as necessary.
+        elem.second.decay( rem_ids, rem_bps, calendar::turn, is_player() );
     }
 
     // Actually remove effects. This should be the last thing done in process_effects().
@@ -1068,7 +1085,7 @@ void Creature::set_moves(int nmoves)
 
 bool Creature::in_sleep_state() const
 {
-    return has_effect("sleep") || has_effect("lying_down");
+    return has_effect(effect_sleep) || has_effect(effect_lying_down);
 }
 
 bool Creature::is_immune( const std::string &type ) const
@@ -13,6 +13,7 @@
 
 #include <stdlib.h>
 #include <string>
+#include <map>
 #include <unordered_map>
 
 class game;
@@ -121,6 +122,12 @@ class Creature
          * @param light_level See @ref game::light_level.
          */
         virtual int sight_range( int light_level ) const = 0;
+        /**
+         * Upper bound of the distance at which @ref sees can return true for another
+         * (non-hallucinated) creature, independent of the current light.
+         * Used to skip candidates before doing the actual line of sight checks.
+         */
+        virtual int max_sight_distance() const;
 
         /** Returns an approximation of the creature's strength. Should always be overwritten by
          *  the appropriate player/NPC/monster function. */
@@ -280,18 +287,23 @@ class Creature
                              bool force = false );
         /** Removes a listed effect, adding the removal memorial log if needed. bp = num_bp means to remove
          *  all effects of a given type, targeted or untargeted. Returns true if anything was removed. */
-        bool remove_effect(efftype_id eff_id, body_part bp = num_bp);
+        bool remove_effect(const efftype_id &eff_id, body_part bp = num_bp);
         /** Remove all effects. */
         void clear_effects();
         /** Check if creature has the matching effect. bp = num_bp means to check if the Creature has any effect
          *  of the matching type, targeted or untargeted. */
-        bool has_effect(efftype_id eff_id, body_part bp = num_bp) const;
+        bool has_effect(const efftype_id &eff_id, body_part bp = num_bp) const;
+        /** Same as above, for an id from @ref effect_type_loadid or an @ref effect_type_handle.
+         *  The string version looks the type up, use this one for effects checked very often. */
+        bool has_effect( int_id<effect_type> eff, body_part bp = num_bp ) const;
         /** Return the effect that matches the given arguments exactly. */
-        effect get_effect(efftype_id eff_id, body_part bp = num_bp) const;
+        effect get_effect(const efftype_id &eff_id, body_part bp = num_bp) const;
         /** Returns the duration of the matching effect. Returns 0 if effect doesn't exist. */
-        int get_effect_dur(efftype_id eff_id, body_part bp = num_bp) const;
+        int get_effect_dur(const efftype_id &eff_id, body_part bp = num_bp) const;
+        int get_effect_dur( int_id<effect_type> eff, body_part bp = num_bp ) const;
         /** Returns the intensity of the matching effect. Returns 0 if effect doesn't exist. */
-        int get_effect_int(efftype_id eff_id, body_part bp = num_bp) const;
+        int get_effect_int(const efftype_id &eff_id, body_part bp = num_bp) const;
+        int get_effect_int( int_id<effect_type> eff, body_part bp = num_bp ) const;
 
         // Methods for setting/getting misc key/value pairs.
         void set_value( const std::string key, const std::string value );
@@ -488,8 +500,18 @@ class Creature
         Creature *killer; // whoever killed us. this should be NULL unless we are dead
         void set_killer( Creature *killer );
 
-        // Storing body_part as an int to make things easier for hash and JSON
-        std::unordered_map<std::string, std::unordered_map<body_part, effect, std::hash<int>>> effects;
+        /**
+         * All effects, keyed by the load order of their type (@ref effect_type::loadid) and
+         * the body part they target. Lookups by id string first find the loadid in
+         * @ref effect_types, unless the creature has no effects at all. It is node based on
+         * purpose: effect processing keeps references to effects while adding new ones.
+         */
+        std::map<std::pair<int, body_part>, effect> effects;
+        /** Returns the effect with exactly this type and body part, or nullptr. */
+        effect *find_effect( const efftype_id &eff_id, body_part bp );
+        const effect *find_effect( const efftype_id &eff_id, body_part bp ) const;
+        effect *find_effect( int_id<effect_type> eff, body_part bp );
+        const effect *find_effect( int_id<effect_type> eff, body_part bp ) const;
         // Miscellaneous key/value pairs.
         std::unordered_map<std::string, std::string> values;
 
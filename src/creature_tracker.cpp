@@ -2,8 +2,13 @@
 #include "monster.h"
 #include "mongroup.h"
 #include "debug.h"
+#include "line.h"
+
+#include <algorithm>
 
 Creature_tracker::Creature_tracker()
+    : monsters_by_cell( cells_per_axis * cells_per_axis * OVERMAP_LAYERS )
+    , cell_entries_by_level( OVERMAP_LAYERS, 0 )
 {
 }
 
@@ -54,6 +59,7 @@ bool Creature_tracker::add( monster &critter )
     }
 
     monsters_by_location[critter.pos3()] = monsters_list.size();
+    add_to_cell( critter.pos3(), monsters_list.size() );
     monsters_list.push_back(new monster(critter));
     return true;
 }
@@ -85,6 +91,8 @@ bool Creature_tracker::update_pos(const monster &critter, const tripoint &new_po
         if( &critter == monsters_list[critter_id] ) {
             monsters_by_location.erase( old_pos );
             monsters_by_location[new_pos] = critter_id;
+            remove_from_cell( old_pos, critter_id );
+            add_to_cell( new_pos, critter_id );
             success = true;
         } else {
             const auto &othermon = *monsters_list[critter_id];
@@ -112,6 +120,7 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
     if( pos_iter != monsters_by_location.end() ) {
         const auto &other = find( pos_iter->second );
         if( &other == &critter ) {
+            remove_from_cell( loc, pos_iter->second );
             monsters_by_location.erase( pos_iter );
         }
     }
@@ -137,6 +146,25 @@ void Creature_tracker::remove( const int idx )
             --elem.second;
         }
     }
+    // Same for the cells, this also drops any entry of the removed monster that was left
+    // in a cell it's not in anymore (because its position changed without update_pos).
+    const auto fix_cell = [idx]( std::vector<size_t> &cell ) {
+        cell.erase( std::remove( cell.begin(), cell.end(), (size_t)idx ), cell.end() );
+        for( auto &i : cell ) {
+            if( i > (size_t)idx ) {
+                --i;
+            }
+        }
+    };
+    for( size_t i = 0; i < monsters_by_cell.size(); i++ ) {
+        auto &cell = monsters_by_cell[i];
+        if( !cell.empty() ) {
+            const size_t old_size = cell.size();
+            fix_cell( cell );
+            cell_entries_by_level[i / ( cells_per_axis * cells_per_axis )] -= old_size - cell.size();
+        }
+    }
+    fix_cell( monsters_outside_cells );
 }
 
 void Creature_tracker::clear()
@@ -146,14 +174,25 @@ void Creature_tracker::clear()
     }
     monsters_list.clear();
     monsters_by_location.clear();
+    for( auto &cell : monsters_by_cell ) {
+        cell.clear();
+    }
+    monsters_outside_cells.clear();
+    std::fill( cell_entries_by_level.begin(), cell_entries_by_level.end(), 0 );
 }
 
 void Creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    for( auto &cell : monsters_by_cell ) {
+        cell.clear();
+    }
+    monsters_outside_cells.clear();
+    std::fill( cell_entries_by_level.begin(), cell_entries_by_level.end(), 0 );
     for( size_t i = 0; i < monsters_list.size(); i++ ) {
         monster &critter = *monsters_list[i];
         monsters_by_location[critter.pos3()] = i;
+        add_to_cell( critter.pos3(), i );
     }
 }
 
@@ -166,3 +205,100 @@ const std::vector<monster> &Creature_tracker::list() const
     }
     return for_now;
 }
+
+std::vector<size_t> &Creature_tracker::cell_at( const tripoint &p )
+{
+    if( p.x < 0 || p.x >= MAPSIZE * SEEX || p.y < 0 || p.y >= MAPSIZE * SEEY ||
+        p.z < -OVERMAP_DEPTH || p.z > OVERMAP_HEIGHT ) {
+        return monsters_outside_cells;
+    }
+    const int z = p.z + OVERMAP_DEPTH;
+    return monsters_by_cell[( z * cells_per_axis + p.y / cell_size ) * cells_per_axis +
+                            p.x / cell_size];
+}
+
+void Creature_tracker::add_to_cell( const tripoint &p, const size_t idx )
+{
+    auto &cell = cell_at( p );
+    cell.push_back( idx );
+    if( &cell != &monsters_outside_cells ) {
+        cell_entries_by_level[p.z + OVERMAP_DEPTH]++;
+    }
+}
+
+void Creature_tracker::remove_from_cell( const tripoint &p, const size_t idx )
+{
+    auto &cell = cell_at( p );
+    const size_t old_size = cell.size();
+    cell.erase( std::remove( cell.begin(), cell.end(), idx ), cell.end() );
+    if( &cell != &monsters_outside_cells ) {
+        cell_entries_by_level[p.z + OVERMAP_DEPTH] -= old_size - cell.size();
+    }
+}
+
+std::vector<int> Creature_tracker::mons_in_rect( const tripoint &min, const tripoint &max ) const
+{
+    std::vector<int> result;
+    // Plain index loops, this is called a lot and iterators are slow in debug builds.
+    const auto visit = [&]( const std::vector<size_t> &cell ) {
+        for( size_t i = 0; i < cell.size(); i++ ) {
+            const size_t idx = cell[i];
+            const monster &critter = *monsters_list[idx];
+            const tripoint &p = critter.pos3();
+            if( !critter.is_dead() &&
+                p.x >= min.x && p.x <= max.x &&
+                p.y >= min.y && p.y <= max.y &&
+                p.z >= min.z && p.z <= max.z ) {
+                result.push_back( idx );
+            }
+        }
+    };
+
+    // The part of the box that is covered by cells.
+    const int min_x = std::max( min.x, 0 );
+    const int max_x = std::min( max.x, MAPSIZE * SEEX - 1 );
+    const int min_y = std::max( min.y, 0 );
+    const int max_y = std::min( max.y, MAPSIZE * SEEY - 1 );
+    const int min_z = std::max( min.z, -OVERMAP_DEPTH );
+    const int max_z = std::min( max.z, OVERMAP_HEIGHT );
+    if( min_x <= max_x && min_y <= max_y ) {
+        for( int z = min_z; z <= max_z; z++ ) {
+            if( cell_entries_by_level[z + OVERMAP_DEPTH] == 0 ) {
+                continue;
+            }
+            for( int cy = min_y / cell_size; cy <= max_y / cell_size; cy++ ) {
+                const int row = ( ( z + OVERMAP_DEPTH ) * cells_per_axis + cy ) * cells_per_axis;
+                for( int cx = min_x / cell_size; cx <= max_x / cell_size; cx++ ) {
+                    const auto &cell = monsters_by_cell[row + cx];
+                    if( !cell.empty() ) {
+                        visit( cell );
+                    }
+                }
+            }
+        }
+    }
+    if( !monsters_outside_cells.empty() ) {
+        visit( monsters_outside_cells );
+    }
+
+    // A monster can appear twice when it was moved without going through update_pos.
+    // Sorting the plain array, the checked iterators of debug builds cost more than the sort.
+    int *const first = result.data();
+    std::sort( first, first + result.size() );
+    result.resize( std::unique( first, first + result.size() ) - first );
+    return result;
+}
+
+std::vector<int> Creature_tracker::mons_in_range( const tripoint &center, const int range ) const
+{
+    const tripoint offset( range, range, range );
+    std::vector<int> result = mons_in_rect( center - offset, center + offset );
+    size_t kept = 0;
+    for( size_t i = 0; i < result.size(); i++ ) {
+        if( rl_dist( center, monsters_list[result[i]]->pos3() ) <= range ) {
+            result[kept++] = result[i];
+        }
+    }
+    result.resize( kept );
+    return result;
+}
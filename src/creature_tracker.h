@@ -2,6 +2,7 @@
 #define CREATURE_TRACKER_H
 
 #include "enums.h"
+#include "game_constants.h"
 #include <vector>
 #include <unordered_map>
 
@@ -27,12 +28,41 @@ class Creature_tracker
         void clear();
         void rebuild_cache();
         const std::vector<monster> &list() const;
+        /**
+         * Returns the indices of all living monsters whose distance (@ref rl_dist) to the
+         * given point is at most range. The indices are sorted in ascending order, so
+         * iterating them visits monsters in the same order as iterating over all indices.
+         */
+        std::vector<int> mons_in_range( const tripoint &center, int range ) const;
+        /**
+         * Returns the indices of all living monsters inside the given box (both corners
+         * included), sorted in ascending order.
+         */
+        std::vector<int> mons_in_rect( const tripoint &min, const tripoint &max ) const;
 
     private:
+        /** Size (in map squares) of the cells of @ref monsters_by_cell. */
+        static constexpr int cell_size = 12;
+        /** Number of cells along the x and y axis of the map. */
+        static constexpr int cells_per_axis = ( MAPSIZE * SEEX + cell_size - 1 ) / cell_size;
         std::vector<monster *> monsters_list;
         std::unordered_map<tripoint, size_t> monsters_by_location;
+        /**
+         * Coarse spatial index, the indices of the monsters inside each cell of
+         * cell_size x cell_size squares of the map (one z-level each), by z, y and x.
+         * Monsters outside of the map (it can happen while the map is shifted) are in
+         * @ref monsters_outside_cells instead.
+         */
+        std::vector<std::vector<size_t>> monsters_by_cell;
+        std::vector<size_t> monsters_outside_cells;
+        /** Number of entries in the cells of each z-level, empty levels are skipped by queries. */
+        std::vector<int> cell_entries_by_level;
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /** The list in @ref monsters_by_cell (or @ref monsters_outside_cells) for that point. */
+        std::vector<size_t> &cell_at( const tripoint &p );
+        void add_to_cell( const tripoint &p, size_t idx );
+        void remove_from_cell( const tripoint &p, size_t idx );
 };
 
 #endif
@@ -1714,7 +1714,7 @@ int editmap::mapgen_preview( real_coords &tc, uimenu &gmenu )
                                 veh1->smy = target_sub.y + y;
                                 veh1->smz = target.z;
                                 destsm->vehicles.push_back( veh1 );
-                                g->m.update_vehicle_cache( veh1, target.z );
+                                g->m.update_vehicle_cache( veh1 );
                             }
                             srcsm->vehicles.clear();
                             g->m.update_vehicle_list( destsm, target.z ); // update real map's vcaches
@@ -1935,8 +1935,6 @@ void editmap::cleartmpmap( tinymap &tmpmap )
         delete smap;
     }
 
-    auto &ch = tmpmap.get_cache( target.z );
-    std::memset( ch.veh_exists_at, 0, sizeof( ch.veh_exists_at ) );
-    ch.veh_cached_parts.clear();
-    ch.vehicle_list.clear();
+    tmpmap.clear_vehicle_cache( target.z );
+    tmpmap.get_cache( target.z ).vehicle_list.clear();
 }
@@ -1158,12 +1158,43 @@ void load_effect_type(JsonObject &jo)
     new_etype.load_mod_data(jo, "base_mods");
     new_etype.load_mod_data(jo, "scaling_mods");
 
-    effect_types[new_etype.id] = new_etype;
+    register_effect_type( new_etype );
+}
+
+/** Changed whenever @ref effect_types changes, see @ref effect_type_handle. */
+static int effect_types_generation = 0;
+
+void register_effect_type( const effect_type &type )
+{
+    const auto existing = effect_types.find( type.id );
+    // All registered types have a loadid, so the loadids are 0 .. size - 1.
+    const int loadid = existing != effect_types.end() ? existing->second.loadid :
+                       effect_types.size();
+    effect_type &stored = effect_types[type.id];
+    stored = type;
+    stored.loadid = loadid;
+    effect_types_generation++;
 }
 
 void reset_effect_types()
 {
     effect_types.clear();
+    effect_types_generation++;
+}
+
+int_id<effect_type> effect_type_loadid( const efftype_id &id )
+{
+    const auto it = effect_types.find( id );
+    return int_id<effect_type>( it != effect_types.end() ? it->second.loadid : -1 );
+}
+
+effect_type_handle::operator int_id<effect_type>() const
+{
+    if( generation != effect_types_generation ) {
+        loadid = effect_type_loadid( id );
+        generation = effect_types_generation;
+    }
+    return loadid;
 }
 
 void effect::serialize(JsonOut &json) const
@@ -1179,7 +1210,10 @@ void effect::serialize(JsonOut &json) const
 void effect::deserialize(JsonIn &jsin)
 {
     JsonObject jo = jsin.get_object();
-    eff_type = &effect_types[jo.get_string("eff_type")];
+    // Unknown types (e.g. from a removed mod) are not added to effect_types,
+    // Creature::load reports and drops those effects.
+    const auto type = effect_types.find( jo.get_string( "eff_type" ) );
+    eff_type = type != effect_types.end() ? &type->second : nullptr;
     duration = jo.get_int("duration");
     bp = (body_part)jo.get_int("bp");
     permanent = jo.get_bool("permanent");
@@ -4,6 +4,7 @@
 #include "pldata.h"
 #include "json.h"
 #include "enums.h"
+#include "int_id.h"
 #include <unordered_map>
 #include <tuple>
 
@@ -33,6 +34,7 @@ class effect_type
         effect_type(const effect_type &rhs);
 
         efftype_id id;
+        int loadid = -1; // # of loaded order, non-saved runtime optimization
 
         /** Returns if an effect is good or bad for message display. */
         effect_rating get_rating() const;
@@ -224,10 +226,15 @@ class effect : public JsonSerializer, public JsonDeserializer
         std::string get_speed_name() const;
 
         /** Returns the effect's matching effect_type id. */
-        efftype_id get_id() const
+        const efftype_id &get_id() const
         {
             return eff_type->id;
         }
+        /** Returns the key of this effect in Creature::effects. */
+        std::pair<int, body_part> get_key() const
+        {
+            return std::make_pair( eff_type->loadid, bp );
+        }
 
         using JsonSerializer::serialize;
         void serialize(JsonOut &json) const override;
@@ -245,5 +252,34 @@ class effect : public JsonSerializer, public JsonDeserializer
 
 void load_effect_type(JsonObject &jo);
 void reset_effect_types();
+/**
+ * Stores the type in @ref effect_types. A new type gets the next free @ref effect_type::loadid,
+ * a type that replaces one with the same id keeps the loadid of the old one.
+ */
+void register_effect_type( const effect_type &type );
+/**
+ * Returns the @ref effect_type::loadid of the type with the given id. Unknown ids give -1,
+ * which is never the loadid of a registered type, so nothing is ever stored with it.
+ */
+int_id<effect_type> effect_type_loadid( const efftype_id &id );
+
+/**
+ * An effect type id for effects that are checked very often, e.g. every turn for every
+ * monster. It remembers the loadid of the type and only looks it up again after the effect
+ * types have changed. Meant to be used as a static constant:
+ * <code>static const effect_type_handle effect_sleep( "sleep" );</code>
+ */
+class effect_type_handle
+{
+    public:
+        explicit effect_type_handle( const efftype_id &id ) : id( id ) { }
+
+        operator int_id<effect_type>() const;
+
+    private:
+        efftype_id id;
+        mutable int_id<effect_type> loadid;
+        mutable int generation = -1;
+};
 
 #endif
@@ -104,6 +104,22 @@ input_context get_default_mode_input_context();
 
 uistatedata uistate;
 
+// Options read every turn or every redraw.
+static const option<bool> opt_animations( "ANIMATIONS" );
+static const option<bool> opt_animation_rain( "ANIMATION_RAIN" );
+static const option<bool> opt_animation_sct( "ANIMATION_SCT" );
+static const option<bool> opt_autosave( "AUTOSAVE" );
+static const option<int> opt_autosave_turns( "AUTOSAVE_TURNS" );
+static const option<int> opt_autosafemode_turns( "AUTOSAFEMODETURNS" );
+static const option<int> opt_safemode_proximity( "SAFEMODEPROXIMITY" );
+static const option<bool> opt_driving_view_offset( "DRIVING_VIEW_OFFSET" );
+static const option<int> opt_move_view_offset( "MOVE_VIEW_OFFSET" );
+static const option<bool> opt_vehicle_dir_indicator( "VEHICLE_DIR_INDICATOR" );
+static const option<int> opt_monster_planning_threads( "MONSTER_PLANNING_THREADS" );
+static const option<bool> opt_auto_pickup( "AUTO_PICKUP" );
+static const option<bool> opt_auto_pickup_safemode( "AUTO_PICKUP_SAFEMODE" );
+static const option<bool> opt_auto_pickup_adjacent( "AUTO_PICKUP_ADJACENT" );
+
 bool is_valid_in_w_terrain(int x, int y)
 {
     return x >= 0 && x < TERRAIN_WINDOW_WIDTH && y >= 0 && y < TERRAIN_WINDOW_HEIGHT;
@@ -1034,7 +1050,7 @@ static int veh_lumi(vehicle *veh)
 
 void game::calc_driving_offset(vehicle *veh)
 {
-    if (veh == nullptr || !OPTIONS["DRIVING_VIEW_OFFSET"]) {
+    if (veh == nullptr || !opt_driving_view_offset) {
         set_driving_view_offset(point(0, 0));
         return;
     }
@@ -1170,8 +1186,8 @@ bool game::do_turn()
     u.update_stamina();
 
     // Auto-save if autosave is enabled
-    if (OPTIONS["AUTOSAVE"] &&
-        calendar::turn % ((int)OPTIONS["AUTOSAVE_TURNS"]) == 0 &&
+    if (opt_autosave &&
+        calendar::turn % opt_autosave_turns == 0 &&
         !u.is_dead_state()) {
         autosave();
     }
@@ -1916,7 +1932,7 @@ input_context game::get_player_input(std::string &action)
         ctxt.register_action("QUIT");
     }
 
-    if (OPTIONS["ANIMATIONS"]) {
+    if (opt_animations) {
         int iStartX = (TERRAIN_WINDOW_WIDTH > 121) ? (TERRAIN_WINDOW_WIDTH - 121) / 2 : 0;
         int iStartY = (TERRAIN_WINDOW_HEIGHT > 121) ? (TERRAIN_WINDOW_HEIGHT - 121) / 2 : 0;
         int iEndX = (TERRAIN_WINDOW_WIDTH > 121) ? TERRAIN_WINDOW_WIDTH - (TERRAIN_WINDOW_WIDTH - 121) / 2 :
@@ -1953,7 +1969,7 @@ input_context game::get_player_input(std::string &action)
         inp_mngr.set_timeout(125);
         // Force at least one animation frame if the player is dead.
         while( handle_mouseview(ctxt, action) || uquit == QUIT_WATCH ) {
-            if (bWeatherEffect && OPTIONS["ANIMATION_RAIN"]) {
+            if (bWeatherEffect && opt_animation_rain) {
                 /*
                 Location to add rain drop animation bits! Since it refreshes w_terrain it can be added to the animation section easily
                 Get tile information from above's weather information:
@@ -1990,7 +2006,7 @@ input_context game::get_player_input(std::string &action)
                 }
             }
             // don't bother calculating SCT if we won't show it
-            if (uquit != QUIT_WATCH && OPTIONS["ANIMATION_SCT"]) {
+            if (uquit != QUIT_WATCH && opt_animation_sct) {
 #ifdef TILES
                 if (!use_tiles) {
 #endif
@@ -2299,7 +2315,7 @@ bool game::handle_action()
     // This has no action unless we're in a special game mode.
     gamemode->pre_action(act);
 
-    int soffset = (int)OPTIONS["MOVE_VIEW_OFFSET"];
+    int soffset = opt_move_view_offset;
     int soffsetr = 0 - soffset;
 
     int before_action_moves = u.moves;
@@ -4843,7 +4859,7 @@ void game::draw_sidebar()
     mvwprintz(day_window, 0, sideStyle ? 0 : 41, c_white, _("%s, day %d"),
               season_name_upper(calendar::turn.get_season()).c_str(), calendar::turn.days() + 1);
     if (safe_mode != SAFE_MODE_OFF || autosafemode != 0) {
-        int iPercent = int((turnssincelastmon * 100) / OPTIONS["AUTOSAFEMODETURNS"]);
+        int iPercent = turnssincelastmon * 100 / opt_autosafemode_turns;
         wmove(w_status, sideStyle ? 4 : 1, getmaxx(w_status) - 4);
         const char *letters[] = { "S", "A", "F", "E" };
         for (int i = 0; i < 4; i++) {
@@ -4981,7 +4997,7 @@ void game::draw_ter( const tripoint &center, const bool looking, const bool draw
 void game::draw_veh_dir_indicator(void)
 {
     // don't draw indicator if doing look_around()
-    if (OPTIONS["VEHICLE_DIR_INDICATOR"]) {
+    if (opt_vehicle_dir_indicator) {
         vehicle *veh = m.veh_at(u.pos());
         if (!veh) {
             debugmsg("game::draw_veh_dir_indicator: no vehicle!");
@@ -5444,7 +5460,7 @@ faction *game::faction_by_ident(std::string id)
 
 Creature *game::is_hostile_nearby()
 {
-    int distance = (OPTIONS["SAFEMODEPROXIMITY"] <= 0) ? 60 : OPTIONS["SAFEMODEPROXIMITY"];
+    int distance = (opt_safemode_proximity <= 0) ? 60 : opt_safemode_proximity;
     return is_hostile_within(distance);
 }
 
@@ -5493,7 +5509,7 @@ int game::mon_info(WINDOW *w)
 
     std::string sbuff;
     int newseen = 0;
-    const int iProxyDist = (OPTIONS["SAFEMODEPROXIMITY"] <= 0) ? 60 : OPTIONS["SAFEMODEPROXIMITY"];
+    const int iProxyDist = (opt_safemode_proximity <= 0) ? 60 : opt_safemode_proximity;
     // 7 0 1    unique_types uses these indices;
     // 6 8 2    0-7 are provide by direction_from()
     // 5 4 3    8 is used for local monsters (for when we explain them below)
@@ -5649,7 +5665,7 @@ int game::mon_info(WINDOW *w)
         }
     } else if (autosafemode && newseen == 0) { // Auto-safemode
         turnssincelastmon++;
-        if (turnssincelastmon >= OPTIONS["AUTOSAFEMODETURNS"] && safe_mode == SAFE_MODE_OFF) {
+        if (turnssincelastmon >= opt_autosafemode_turns && safe_mode == SAFE_MODE_OFF) {
             safe_mode = SAFE_MODE_ON;
         }
     }
@@ -5819,6 +5835,31 @@ void game::monmove()
 {
     cleanup_dead();
 
+    // Lines of sight from last turn are mostly stale (monsters moved), drop them so the
+    // memo does not grow without bound while waiting or sleeping.
+    m.clear_los_cache();
+
+    // The line of sight checks in monster::plan don't change anything and are the bulk of
+    // its work, so do the most common ones (can I see the player / NPCs?) up front, possibly
+    // on several threads. plan() then finds them in the cache of map::sees.
+    std::vector<std::pair<tripoint, tripoint>> sight_lines;
+    for( size_t i = 0; i < num_zombies(); i++ ) {
+        const monster &critter = zombie( i );
+        if( critter.is_dead() || critter.friendly != 0 ) {
+            continue;
+        }
+        const int range = critter.max_sight_distance();
+        if( critter.posz() == u.posz() && rl_dist( critter.pos3(), u.pos3() ) <= range ) {
+            sight_lines.emplace_back( critter.pos3(), u.pos3() );
+        }
+        for( const npc *guy : active_npc ) {
+            if( critter.posz() == guy->posz() && rl_dist( critter.pos3(), guy->pos3() ) <= range ) {
+                sight_lines.emplace_back( critter.pos3(), guy->pos3() );
+            }
+        }
+    }
+    m.precompute_sees( sight_lines, opt_monster_planning_threads );
+
     // Make sure these don't match the first time around.
     tripoint cached_lev = m.get_abs_sub() + tripoint( 1, 0, 0 );
 
@@ -6026,7 +6067,7 @@ void game::explosion( const tripoint &p, int power, int shrapnel, bool fire, boo
         return;
     }
 
-    bool const do_animation = p.z == u.posz() && OPTIONS["ANIMATIONS"];
+    bool const do_animation = p.z == u.posz() && opt_animations;
 
     int t1, t2;
     std::vector<tripoint> traj;
@@ -6795,6 +6836,16 @@ int game::mon_at( const tripoint &p ) const
     return critter_tracker->mon_at( p );
 }
 
+std::vector<int> game::mons_in_range( const tripoint &p, const int range ) const
+{
+    return critter_tracker->mons_in_range( p, range );
+}
+
+std::vector<int> game::mons_in_rect( const tripoint &min, const tripoint &max ) const
+{
+    return critter_tracker->mons_in_rect( min, max );
+}
+
 monster *game::monster_at(const tripoint &p)
 {
     return &zombie(critter_tracker->mon_at(p));
@@ -7873,6 +7924,8 @@ void game::examine( const tripoint &p )
         use_computer( examp );
         return;
     }
+    // Funnel containers get the rain they collected before they are looked at.
+    m.fill_funnels( examp );
     const furn_t *xfurn_t = &furnlist[m.furn(examp)];
     const ter_t *xter_t = &terlist[m.ter(examp)];
 
@@ -7977,6 +8030,7 @@ tripoint game::look_debug()
 void game::print_all_tile_info( const tripoint &lp, WINDOW *w_look, int column, int &line,
                                 bool mouse_hover )
 {
+    m.fill_funnels( lp );
     print_terrain_info( lp, w_look, column, line );
     print_fields_info( lp, w_look, column, line );
     print_trap_info( lp, w_look, column, line );
@@ -8526,7 +8580,7 @@ tripoint game::look_around( WINDOW *w_info, const tripoint &start_point,
 
     draw_ter( lp );
 
-    int soffset = (int)OPTIONS["MOVE_VIEW_OFFSET"];
+    int soffset = opt_move_view_offset;
     bool fast_scroll = false;
     bool bBlink = false;
 
@@ -8848,6 +8902,7 @@ std::vector<map_item_stack> game::find_nearby_items(int iRadius)
             u.sees( points_p_it ) &&
             m.sees_some_items( points_p_it, u ) ) {
 
+            m.fill_funnels( points_p_it );
             for( auto &elem : m.i_at( points_p_it ) ) {
                 const std::string name = elem.tname();
 
@@ -9255,6 +9310,9 @@ int game::list_items(const int iLastState)
     int iCatSortNum = 0;
     map_item_stack *activeItem = NULL;
     std::map<int, std::string> mSortCategory;
+    // Info of the selected item, only rebuilt when the selection changes
+    const item *info_item = NULL;
+    std::vector<iteminfo> info_lines;
 
     std::string action;
     input_context ctxt("LIST_ITEMS");
@@ -9387,6 +9445,7 @@ int game::list_items(const int iLastState)
             if (reset) {
                 reset_item_list_state(w_items_border, iInfoHeight, sort_radius);
                 reset = false;
+                info_item = NULL;
             }
 
             if (action == "UP") {
@@ -9523,10 +9582,13 @@ int game::list_items(const int iLastState)
                 werase(w_item_info);
 
                 if ( iItemNum > 0 ) {
-                    std::vector<iteminfo> vThisItem, vDummy;
-                    activeItem->example->info(true, &vThisItem);
-
-                    draw_item_info(w_item_info, "", vThisItem, vDummy, 0, true, true);
+                    if( info_item != activeItem->example ) {
+                        info_item = activeItem->example;
+                        info_lines.clear();
+                        info_item->info(true, &info_lines);
+                    }
+                    std::vector<iteminfo> vDummy;
+                    draw_item_info(w_item_info, "", info_lines, vDummy, 0, true, true);
 
                     //Only redraw trail/terrain if x/y position changed
                     if( active_pos != iLastActive ) {
@@ -12149,8 +12211,8 @@ bool game::plmove(int dx, int dy)
         }
 
         //Autopickup
-        if (OPTIONS["AUTO_PICKUP"] && (!OPTIONS["AUTO_PICKUP_SAFEMODE"] || mostseen == 0) &&
-            ((m.i_at(u.pos())).size() || OPTIONS["AUTO_PICKUP_ADJACENT"])) {
+        if (opt_auto_pickup && (!opt_auto_pickup_safemode || mostseen == 0) &&
+            ((m.i_at(u.pos())).size() || opt_auto_pickup_adjacent)) {
             Pickup::pick_up(u.pos(), -1);
         }
 
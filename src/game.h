@@ -204,6 +204,10 @@ class game
 
         /** Returns the monster index of the monster at the given tripoint. Returns -1 if no monster is present. */
         int mon_at( const tripoint &p ) const;
+        /** Returns the indices of all monsters within range of p, see Creature_tracker::mons_in_range. */
+        std::vector<int> mons_in_range( const tripoint &p, int range ) const;
+        /** Returns the indices of all monsters inside the box, see Creature_tracker::mons_in_rect. */
+        std::vector<int> mons_in_rect( const tripoint &min, const tripoint &max ) const;
         /** Returns a pointer to the monster at the given tripoint. */
         monster *monster_at( const tripoint &p);
         /** Returns true if there is no player, NPC, or monster on the tile and move_cost > 0. */
@@ -51,6 +51,9 @@
 #include <fstream>
 #include <sstream> // for throwing errors
 #include <locale> // for loading names
+#include <thread>
+#include <chrono>
+#include <functional>
 
 #include "savegame.h"
 
@@ -227,47 +230,13 @@ void DynamicDataLoader::reset()
     type_function_map.clear();
 }
 
-void DynamicDataLoader::load_data_from_path(const std::string &path)
-{
-    // We assume that each folder is consistent in itself,
-    // and all the previously loaded folders.
-    // E.g. the core might provide a vpart "frame-x"
-    // the first loaded mode might provide a vehicle that uses that frame
-    // But not the other way round.
-
-    // get a list of all files in the directory
-    str_vec files = get_files_from_path(".json", path, true, true);
-    if (files.empty()) {
-        std::ifstream tmp(path.c_str(), std::ios::in);
-        if (tmp) {
-            // path is actually a file, don't checking the extension,
-            // assume we want to load this file anyway
-            files.push_back(path);
-        }
-    }
-    // iterate over each file
-    for( auto &files_i : files ) {
-        const std::string &file = files_i;
-        // open the file as a stream
-        std::ifstream infile(file.c_str(), std::ifstream::in | std::ifstream::binary);
-        // and stuff it into ram
-        std::istringstream iss(
-            std::string(
-                (std::istreambuf_iterator<char>(infile)),
-                std::istreambuf_iterator<char>()
-            )
-        );
-        try {
-            // parse it
-            JsonIn jsin(iss);
-            load_all_from_json(jsin);
-        } catch (std::string e) {
-            throw file + ": " + e;
-        }
-    }
-}
-
-void DynamicDataLoader::load_all_from_json(JsonIn &jsin)
+/**
+ * Calls the function for each top level object of a json file, which may contain a single
+ * object or an array of objects. The function gets the stream positioned at the start of
+ * the object and must leave it at the end of the object.
+ * @throws std::string if the file contains something else.
+ */
+static void for_each_json_object( JsonIn &jsin, const std::function<void( JsonIn & )> &func )
 {
     char ch;
     jsin.eat_whitespace();
@@ -275,9 +244,7 @@ void DynamicDataLoader::load_all_from_json(JsonIn &jsin)
     ch = jsin.peek();
     if (ch == '{') {
         // find type and dispatch single object
-        JsonObject jo = jsin.get_object();
-        load_object(jo);
-        jo.finish();
+        func( jsin );
         // if there's anything else in the file, it's an error.
         jsin.eat_whitespace();
         if (jsin.good()) {
@@ -300,9 +267,7 @@ void DynamicDataLoader::load_all_from_json(JsonIn &jsin)
                 err << ch << "', not '{'";
                 throw err.str();
             }
-            JsonObject jo = jsin.get_object();
-            load_object(jo);
-            jo.finish();
+            func( jsin );
         }
     } else {
         // not an object or an array?
@@ -313,6 +278,123 @@ void DynamicDataLoader::load_all_from_json(JsonIn &jsin)
     }
 }
 
+/**
+ * A json file read into memory and split into its top level objects. This does not depend
+ * on any other data, so it is done for all files of a folder in parallel, the objects are
+ * then given to the loaders in file order.
+ */
+struct json_file_objects {
+    std::string path;
+    std::istringstream data;
+    std::unique_ptr<JsonIn> jsin;
+    // Heap allocated because a JsonObject seeks the stream when it is destroyed.
+    std::vector<std::unique_ptr<JsonObject>> objects;
+    // Set if the file is malformed. The objects before the error are loaded anyway,
+    // like they were when reading and loading went hand in hand.
+    bool failed = false;
+    std::string error;
+    std::chrono::duration<double> split_time;
+};
+
+static void split_json_file( json_file_objects &file )
+{
+    const auto start = std::chrono::steady_clock::now();
+    // open the file as a stream and stuff it into ram
+    std::ifstream infile( file.path.c_str(), std::ifstream::in | std::ifstream::binary );
+    file.data.str( std::string( ( std::istreambuf_iterator<char>( infile ) ),
+                                std::istreambuf_iterator<char>() ) );
+    file.jsin.reset( new JsonIn( file.data ) );
+    try {
+        for_each_json_object( *file.jsin, [&file]( JsonIn & jsin ) {
+            // Indexes the members and leaves the stream at the end of the object.
+            file.objects.emplace_back( new JsonObject( jsin ) );
+        } );
+    } catch( std::string e ) {
+        file.failed = true;
+        file.error = e;
+    }
+    file.split_time = std::chrono::steady_clock::now() - start;
+}
+
+void DynamicDataLoader::load_data_from_path(const std::string &path)
+{
+    // We assume that each folder is consistent in itself,
+    // and all the previously loaded folders.
+    // E.g. the core might provide a vpart "frame-x"
+    // the first loaded mode might provide a vehicle that uses that frame
+    // But not the other way round.
+
+    // get a list of all files in the directory
+    str_vec files = get_files_from_path(".json", path, true, true);
+    if (files.empty()) {
+        std::ifstream tmp(path.c_str(), std::ios::in);
+        if (tmp) {
+            // path is actually a file, don't checking the extension,
+            // assume we want to load this file anyway
+            files.push_back(path);
+        }
+    }
+
+    std::vector<std::unique_ptr<json_file_objects>> parsed;
+    for( auto &file : files ) {
+        parsed.emplace_back( new json_file_objects() );
+        parsed.back()->path = file;
+    }
+    const auto split_files = [&parsed]( const size_t first, const size_t step ) {
+        for( size_t i = first; i < parsed.size(); i += step ) {
+            split_json_file( *parsed[i] );
+        }
+    };
+    const size_t num_threads = std::max<size_t>( 1, std::min<size_t>(
+                                   std::thread::hardware_concurrency(), parsed.size() ) );
+    std::vector<std::thread> workers;
+    for( size_t t = 1; t < num_threads; t++ ) {
+        workers.emplace_back( split_files, t, num_threads );
+    }
+    split_files( 0, num_threads );
+    for( auto &worker : workers ) {
+        worker.join();
+    }
+
+    // The loaders depend on each other and on the order of the files, so this part is serial.
+    std::map<type_string, std::chrono::duration<double>> type_times;
+    for( auto &file : parsed ) {
+        const auto start = std::chrono::steady_clock::now();
+        try {
+            for( auto &jo : file->objects ) {
+                const auto object_start = std::chrono::steady_clock::now();
+                const type_string type = jo->get_string( "type", "" );
+                load_object( *jo );
+                jo->finish();
+                type_times[type] += std::chrono::steady_clock::now() - object_start;
+            }
+        } catch (std::string e) {
+            throw file->path + ": " + e;
+        }
+        if( file->failed ) {
+            throw file->path + ": " + file->error;
+        }
+        const std::chrono::duration<double> load_time = std::chrono::steady_clock::now() - start;
+        DebugLog( D_INFO, DC_ALL ) << "Loaded " << file->path << ": read and split in "
+                                   << file->split_time.count() << "s, loaded in " << load_time.count() << "s";
+        // Not needed anymore, free the memory of the file.
+        file.reset();
+    }
+    for( auto &elem : type_times ) {
+        DebugLog( D_INFO, DC_ALL ) << "Loading json type " << elem.first << " from " << path << " took "
+                                   << elem.second.count() << "s";
+    }
+}
+
+void DynamicDataLoader::load_all_from_json(JsonIn &jsin)
+{
+    for_each_json_object( jsin, [this]( JsonIn & jsin ) {
+        JsonObject jo = jsin.get_object();
+        load_object( jo );
+        jo.finish();
+    } );
+}
+
 void init_names()
 {
     const std::string filename = PATH_INFO::find_translated_file( "namesdir",
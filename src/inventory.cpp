@@ -1,4 +1,5 @@
 #include <sstream>
+#include <algorithm>
 #include "inventory.h"
 #include "game.h"
 #include "map.h"
@@ -75,14 +76,16 @@ bool inventory::is_sorted() const
 
 inventory &inventory::operator+= (const inventory &rhs)
 {
-    for (size_t i = 0; i < rhs.size(); i++) {
-        add_stack(rhs.const_stack(i));
+    bulk_add adding( *this );
+    for( const auto &stack : rhs.items ) {
+        add_stack( stack );
     }
     return *this;
 }
 
 inventory &inventory::operator+= (const std::list<item> &rhs)
 {
+    bulk_add adding( *this );
     for( const auto &rh : rhs ) {
         add_item( rh, false, false );
     }
@@ -91,6 +94,7 @@ inventory &inventory::operator+= (const std::list<item> &rhs)
 
 inventory &inventory::operator+= (const std::vector<item> &rhs)
 {
+    bulk_add adding( *this );
     for( const auto &rh : rhs ) {
         add_item( rh, true );
     }
@@ -209,6 +213,10 @@ void inventory::sort()
 
 void inventory::clear()
 {
+    totals.reset();
+    if( index.get() != nullptr ) {
+        index.set( new stack_index() );
+    }
     items.clear();
 }
 
@@ -224,6 +232,8 @@ void inventory::add_stack(const std::list<item> newits)
  */
 void inventory::clone_stack (const std::list<item> &rhs)
 {
+    totals.reset();
+    index.reset();
     std::list<item> newstack;
     for( const auto &rh : rhs ) {
         newstack.push_back( rh );
@@ -289,10 +299,15 @@ char inventory::find_usable_cached_invlet(const std::string &item_type)
         }
         // Check if anything is using this invlet.
         bool invlet_is_used = false;
-        for( auto &elem : items ) {
-            if( elem.front().invlet == invlet ) {
-                invlet_is_used = true;
-                break;
+        if( index.get() != nullptr ) {
+            const auto iter = index.get()->by_invlet.find( invlet );
+            invlet_is_used = iter != index.get()->by_invlet.end() && !iter->second.empty();
+        } else {
+            for( auto &elem : items ) {
+                if( elem.front().invlet == invlet ) {
+                    invlet_is_used = true;
+                    break;
+                }
             }
         }
         if( !invlet_is_used ) {
@@ -305,6 +320,7 @@ char inventory::find_usable_cached_invlet(const std::string &item_type)
 
 item &inventory::add_item(item newit, bool keep_invlet, bool assign_invlet)
 {
+    totals.reset();
     bool reuse_cached_letter = false;
 
     // Avoid letters that have been manually assigned to other things.
@@ -334,18 +350,25 @@ item &inventory::add_item(item newit, bool keep_invlet, bool assign_invlet)
 
 
     // See if we can't stack this item.
-    for( auto &elem : items ) {
-        std::list<item>::iterator it_ref = elem.begin();
-        if( it_ref->stacks_with( newit ) ) {
-            if( it_ref->merge_charges( newit ) ) {
-                return *it_ref;
+    if( index.get() != nullptr ) {
+        item *merged = stack_indexed( newit, keep_invlet && assign_invlet );
+        if( merged != nullptr ) {
+            return *merged;
+        }
+    } else {
+        for( auto &elem : items ) {
+            std::list<item>::iterator it_ref = elem.begin();
+            if( it_ref->stacks_with( newit ) ) {
+                if( it_ref->merge_charges( newit ) ) {
+                    return *it_ref;
+                }
+                newit.invlet = it_ref->invlet;
+                elem.push_back( newit );
+                return elem.back();
+            } else if( keep_invlet && assign_invlet && it_ref->invlet == newit.invlet ) {
+                // If keep_invlet is true, we'll be forcing other items out of their current invlet.
+                assign_empty_invlet(*it_ref);
             }
-            newit.invlet = it_ref->invlet;
-            elem.push_back( newit );
-            return elem.back();
-        } else if( keep_invlet && assign_invlet && it_ref->invlet == newit.invlet ) {
-            // If keep_invlet is true, we'll be forcing other items out of their current invlet.
-            assign_empty_invlet(*it_ref);
         }
     }
 
@@ -357,9 +380,97 @@ item &inventory::add_item(item newit, bool keep_invlet, bool assign_invlet)
     std::list<item> newstack;
     newstack.push_back(newit);
     items.push_back(newstack);
+    if( index.get() != nullptr ) {
+        index.get()->add( items.back() );
+    }
     return items.back().back();
 }
 
+// Must give the same result as the loop over all stacks in add_item.
+item *inventory::stack_indexed( item &newit, bool move_conflicting_invlets )
+{
+    stack_index &idx = *index.get();
+    // The first stack the item stacks with.
+    std::list<item> *target = nullptr;
+    size_t target_pos = idx.count;
+    const auto type_iter = idx.by_type.find( newit.type );
+    if( type_iter != idx.by_type.end() ) {
+        for( auto &elem : type_iter->second ) {
+            if( elem.second->front().stacks_with( newit ) ) {
+                target = elem.second;
+                target_pos = elem.first;
+                break;
+            }
+        }
+    }
+    // The stacks before it that have the invlet of the new item lose it.
+    if( move_conflicting_invlets ) {
+        const auto invlet_iter = idx.by_invlet.find( newit.invlet );
+        if( invlet_iter != idx.by_invlet.end() ) {
+            // Moving the invlet changes the index, work on a copy.
+            const stack_index::stack_list conflicts = invlet_iter->second;
+            for( auto &elem : conflicts ) {
+                if( elem.first >= target_pos ) {
+                    break;
+                }
+                assign_empty_invlet( elem.second->front() );
+                idx.change_invlet( *elem.second, newit.invlet );
+            }
+        }
+    }
+    if( target == nullptr ) {
+        return nullptr;
+    }
+    item &it_ref = target->front();
+    if( it_ref.merge_charges( newit ) ) {
+        return &it_ref;
+    }
+    newit.invlet = it_ref.invlet;
+    target->push_back( newit );
+    return &target->back();
+}
+
+void inventory::stack_index::add( std::list<item> &stack )
+{
+    by_type[stack.front().type].emplace_back( count, &stack );
+    by_invlet[stack.front().invlet].emplace_back( count, &stack );
+    count++;
+}
+
+void inventory::stack_index::change_invlet( std::list<item> &stack, char old_invlet )
+{
+    const char new_invlet = stack.front().invlet;
+    if( new_invlet == old_invlet ) {
+        return;
+    }
+    stack_list &old_list = by_invlet[old_invlet];
+    const auto iter = std::find_if( old_list.begin(), old_list.end(),
+    [&stack]( const stack_list::value_type & elem ) {
+        return elem.second == &stack;
+    } );
+    const auto entry = *iter;
+    old_list.erase( iter );
+    stack_list &new_list = by_invlet[new_invlet];
+    new_list.insert( std::upper_bound( new_list.begin(), new_list.end(), entry ), entry );
+}
+
+inventory::bulk_add::bulk_add( inventory &inv ) : inv( inv ), owner( inv.index.get() == nullptr )
+{
+    if( owner ) {
+        inv.index.set( new stack_index() );
+        for( auto &stack : inv.items ) {
+            inv.index.get()->add( stack );
+        }
+    }
+}
+
+inventory::bulk_add::~bulk_add()
+{
+    if( owner ) {
+        inv.index.reset();
+    }
+}
+
 void inventory::add_item_keep_invlet(item newit)
 {
     add_item(newit, true);
@@ -377,6 +488,8 @@ void inventory::restack(player *p)
     // 1. reassign inventory letters
     // 2. remove items from non-matching stacks
     // 3. combine matching stacks
+    totals.reset();
+    index.reset();
 
     if (!p) {
         return;
@@ -434,7 +547,8 @@ static long count_charges_in_list(const itype *type, const map_stack &items)
 
 void inventory::form_from_map( const tripoint &origin, int range, bool assign_invlet )
 {
-    items.clear();
+    clear();
+    bulk_add adding( *this );
     // TODO: Z
     tripoint p( origin.x - range, origin.y - range, origin.z );
     int &x = p.x;
@@ -457,6 +571,8 @@ void inventory::form_from_map( const tripoint &origin, int range, bool assign_in
             if( !g->m.accessible_items( origin, p, range ) ) {
                 continue;
             }
+            // Rain collected by a funnel is usable for crafting.
+            g->m.fill_funnels( p );
             for (auto &i : g->m.i_at(x, y)) {
                 if (!i.made_of(LIQUID)) {
                     add_item(i, false, assign_invlet);
@@ -608,6 +724,8 @@ void inventory::form_from_map( const tripoint &origin, int range, bool assign_in
 template<typename Locator>
 std::list<item> inventory::reduce_stack_internal(const Locator &locator, int quantity)
 {
+    totals.reset();
+    index.reset();
     int pos = 0;
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end(); ++iter) {
@@ -651,6 +769,8 @@ item inventory::remove_item(const item *it)
 template<typename Locator>
 item inventory::remove_item_internal(const Locator &locator)
 {
+    totals.reset();
+    index.reset();
     int pos = 0;
     for (invstack::iterator iter = items.begin(); iter != items.end(); ++iter) {
         if (item_matches_locator(iter->front(), locator, pos)) {
@@ -789,6 +909,11 @@ int inventory::amount_of(itype_id it) const
 
 int inventory::amount_of(itype_id it, bool used_as_tool) const
 {
+    if( totals.get() != nullptr ) {
+        const auto &amounts = used_as_tool ? totals.get()->amount : totals.get()->amount_not_pseudo;
+        const auto iter = amounts.find( it );
+        return iter != amounts.end() ? iter->second : 0;
+    }
     int count = 0;
     for( const auto &elem : items ) {
         for( const auto &elem_stack_iter : elem ) {
@@ -800,6 +925,10 @@ int inventory::amount_of(itype_id it, bool used_as_tool) const
 
 long inventory::charges_of(itype_id it) const
 {
+    if( totals.get() != nullptr ) {
+        const auto iter = totals.get()->charges.find( it );
+        return iter != totals.get()->charges.end() ? iter->second : 0;
+    }
     int count = 0;
     for( const auto &elem : items ) {
         for( const auto &elem_stack_iter : elem ) {
@@ -812,6 +941,8 @@ long inventory::charges_of(itype_id it) const
 std::list<item> inventory::use_amount(itype_id it, int _quantity, bool use_container)
 {
     long quantity = _quantity; // Don't wanny change the function signature right now
+    totals.reset();
+    index.reset();
     sort();
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */) {
@@ -835,6 +966,8 @@ std::list<item> inventory::use_amount(itype_id it, int _quantity, bool use_conta
 
 std::list<item> inventory::use_charges(itype_id it, long quantity)
 {
+    totals.reset();
+    index.reset();
     sort();
     std::list<item> ret;
     for (invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */) {
@@ -890,6 +1023,15 @@ bool inventory::has_item( const item *it ) const
 bool inventory::has_items_with_quality(std::string id, int level, int amount) const
 {
     int found = 0;
+    if( totals.get() != nullptr ) {
+        const auto iter = totals.get()->qualities.find( id );
+        if( iter != totals.get()->qualities.end() ) {
+            for( auto it = iter->second.lower_bound( level ); it != iter->second.end(); ++it ) {
+                found += it->second;
+            }
+        }
+        return found >= amount;
+    }
     for( const auto &elem : items ) {
         for( const auto &elem_stack_iter : elem ) {
             if( !elem_stack_iter.contents.empty() && elem_stack_iter.is_container() ) {
@@ -911,6 +1053,75 @@ bool inventory::has_items_with_quality(std::string id, int level, int amount) co
     }
 }
 
+static void add_best_qualities( std::map<std::string, int> &best, const item &it )
+{
+    for( const auto &quality : it.type->qualities ) {
+        auto iter = best.find( quality.first );
+        if( iter == best.end() ) {
+            best.insert( quality );
+        } else {
+            iter->second = std::max( iter->second, quality.second );
+        }
+    }
+    for( const auto &content : it.contents ) {
+        add_best_qualities( best, content );
+    }
+}
+
+void inventory::item_totals::add_amount( const item &it )
+{
+    // Must match item::amount_of
+    if( it.contents.empty() ) {
+        amount[it.typeId()]++;
+        if( !it.has_flag( "PSEUDO" ) ) {
+            amount_not_pseudo[it.typeId()]++;
+        }
+    }
+    for( const auto &content : it.contents ) {
+        add_amount( content );
+    }
+}
+
+void inventory::item_totals::add_charges( const item &it )
+{
+    // Must match item::charges_of
+    if( !it.contents.empty() ) {
+        for( const auto &content : it.contents ) {
+            add_charges( content );
+        }
+        return;
+    }
+    const long count = it.charges < 0 ? 1 : it.charges;
+    charges[it.typeId()] += count;
+    if( it.is_tool() ) {
+        const itype_id &subtype = dynamic_cast<const it_tool *>( it.type )->subtype;
+        if( !subtype.empty() && subtype != it.typeId() ) {
+            charges[subtype] += count;
+        }
+    }
+}
+
+void inventory::cache_totals()
+{
+    item_totals *result = new item_totals();
+    for( const auto &stack : items ) {
+        for( const auto &it : stack ) {
+            result->add_amount( it );
+            result->add_charges( it );
+            // Must match has_items_with_quality
+            if( !it.contents.empty() && it.is_container() ) {
+                continue;
+            }
+            std::map<std::string, int> best;
+            add_best_qualities( best, it );
+            for( const auto &quality : best ) {
+                result->qualities[quality.first][quality.second] += it.count_by_charges() ? it.charges : 1;
+            }
+        }
+    }
+    totals.set( result );
+}
+
 int inventory::leak_level(std::string flag) const
 {
     int ret = 0;
@@ -9,6 +9,9 @@
 #include <utility>
 #include <vector>
 #include <functional>
+#include <map>
+#include <memory>
+#include <unordered_map>
 
 class map;
 class npc;
@@ -131,6 +134,17 @@ class inventory
         bool has_item(const item *it) const;
         bool has_items_with_quality(std::string id, int level, int amount) const;
 
+        /**
+         * Counts what @ref amount_of, @ref charges_of and @ref has_items_with_quality
+         * would count, for all item types and qualities at once. Those functions then
+         * answer from the totals instead of looking at every item.
+         * Meant for inventories that are queried a lot but not changed, like the
+         * crafting inventory. Adding or removing items through the inventory drops
+         * the totals, changing an item through a reference into the inventory does not.
+         * Copies of the inventory don't get the totals.
+         */
+        void cache_totals();
+
         static int num_items_at_position( int position );
 
         int leak_level(std::string flag) const; // level of leaked bad stuff from items
@@ -259,6 +273,8 @@ class inventory
         template<typename T>
         std::list<item> remove_items_with( T filter )
         {
+            totals.reset();
+            index.reset();
             std::list<item> result;
             for( auto items_it = items.begin(); items_it != items.end(); ) {
                 auto &stack = *items_it;
@@ -296,6 +312,75 @@ class inventory
 
         invstack items;
         bool sorted;
+
+        struct item_totals {
+            std::unordered_map<itype_id, int> amount;
+            // Same as amount, without the PSEUDO items, see item::amount_of.
+            std::unordered_map<itype_id, int> amount_not_pseudo;
+            std::unordered_map<itype_id, long> charges;
+            // quality id -> best level of an item -> number of those items
+            std::unordered_map<std::string, std::map<int, int>> qualities;
+
+            void add_amount( const item &it );
+            void add_charges( const item &it );
+        };
+        /**
+         * The stacks by the type of their items and by the invlet of their first item,
+         * each in the order of @ref items. Nothing tells the inventory when an item in it
+         * changes, so this only exists while a function adds many items at once, see
+         * @ref bulk_add. @ref add_item then only compares the new item with the stacks
+         * it could merge with or whose invlet it could take.
+         */
+        struct stack_index {
+            typedef std::vector<std::pair<size_t, std::list<item> *>> stack_list;
+            std::unordered_map<const itype *, stack_list> by_type;
+            std::unordered_map<char, stack_list> by_invlet;
+            size_t count = 0;
+
+            void add( std::list<item> &stack );
+            void change_invlet( std::list<item> &stack, char old_invlet );
+        };
+        // Sets up the stack index for its lifetime, unless one is already set up.
+        class bulk_add
+        {
+            public:
+                bulk_add( inventory &inv );
+                ~bulk_add();
+            private:
+                inventory &inv;
+                bool owner;
+        };
+        // The part of add_item that merges the item into a stack, using the index.
+        item *stack_indexed( item &newit, bool move_conflicting_invlets );
+
+        // Owns an optional object that is kept when moved and dropped when copied.
+        template<typename T>
+        class not_copied
+        {
+            public:
+                not_copied() = default;
+                not_copied( not_copied && ) = default;
+                not_copied( const not_copied & ) {}
+                not_copied &operator=( not_copied && ) = default;
+                not_copied &operator=( const not_copied & ) {
+                    data.reset();
+                    return *this;
+                }
+
+                T *get() const {
+                    return data.get();
+                }
+                void set( T *value ) {
+                    data.reset( value );
+                }
+                void reset() {
+                    data.reset();
+                }
+            private:
+                std::unique_ptr<T> data;
+        };
+        not_copied<item_totals> totals;
+        not_copied<stack_index> index;
 };
 
 #endif
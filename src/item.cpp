@@ -74,7 +74,7 @@ item::item()
     init();
 }
 
-item::item(const std::string new_type, unsigned int turn, bool rand, const handedness handed)
+item::item(const std::string &new_type, unsigned int turn, bool rand, const handedness handed)
 {
     init();
     type = find_type( new_type );
@@ -1525,13 +1525,12 @@ std::string item::info(bool showtext, std::vector<iteminfo> *dump, bool debug) c
         } else { // use the contained item
             tid = contents[0].type->id;
         }
-        std::vector<recipe *> &rec = recipes_by_component[tid];
-        if (!rec.empty()) {
+        const auto rec = recipes_by_component.find(tid);
+        if (rec != recipes_by_component.end()) {
             temp1.str("");
-            const inventory &inv = g->u.crafting_inventory();
             // only want known recipes
             std::vector<recipe *> known_recipes;
-            for (recipe *r : rec) {
+            for (recipe *r : rec->second) {
                 if (g->u.knows_recipe(r)) {
                     known_recipes.push_back(r);
                 }
@@ -1540,7 +1539,9 @@ std::string item::info(bool showtext, std::vector<iteminfo> *dump, bool debug) c
                 dump->push_back(iteminfo("DESCRIPTION", _("You know dozens of things you could craft with it.")));
             } else if (known_recipes.size() > 12) {
                 dump->push_back(iteminfo("DESCRIPTION", _("You could use it to craft various other things.")));
-            } else {
+            } else if (!known_recipes.empty()) {
+                // Only needed to darken the listed recipes, forming it scans the surroundings.
+                const inventory &inv = g->u.crafting_inventory();
                 bool found_recipe = false;
                 for (recipe* r : known_recipes) {
                     if (found_recipe) {
@@ -1746,12 +1747,13 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
     std::stringstream ret;
 
 // MATERIALS-TODO: put this in json
+    static const option<bool> opt_item_health_bar( "ITEM_HEALTH_BAR" );
     std::string damtext = "";
-    if ((damage != 0 || ( OPTIONS["ITEM_HEALTH_BAR"] && is_armor() )) && !is_null() && with_prefix) {
+    if ((damage != 0 || ( opt_item_health_bar && is_armor() )) && !is_null() && with_prefix) {
         if( damage < 0 )  {
             if( damage < -1 ) {
                 damtext = rm_prefix(_("<dam_adj>bugged "));
-            } else if ( OPTIONS["ITEM_HEALTH_BAR"] ) {
+            } else if ( opt_item_health_bar ) {
                 auto const &nc_text = get_item_hp_bar(damage);
                 damtext = "<color_" + string_from_color(nc_text.second) + ">" + nc_text.first + " </color>";
             } else if (is_gun())  {
@@ -1766,7 +1768,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix ) const
                 if (damage == 3) damtext = rm_prefix(_("<dam_adj>mangled "));
                 if (damage == 4) damtext = rm_prefix(_("<dam_adj>pulped "));
 
-            } else if ( OPTIONS["ITEM_HEALTH_BAR"] ) {
+            } else if ( opt_item_health_bar ) {
                 auto const &nc_text = get_item_hp_bar(damage);
                 damtext = "<color_" + string_from_color(nc_text.second) + ">" + nc_text.first + " </color>";
 
@@ -72,8 +72,7 @@ void Item_factory::finialize_item_blacklist()
             debugmsg("item on blacklist %s does not exist", a->c_str());
         }
     }
-    for (std::map<std::string, itype *>::const_iterator a = m_templates.begin(); a != m_templates.end();
-         ++a) {
+    for( auto a = m_templates.begin(); a != m_templates.end(); ++a ) {
         const std::string &itm = a->first;
         if (!item_is_blacklisted(itm)) {
             continue;
@@ -514,9 +513,9 @@ bool Item_factory::has_template(const Item_tag &id) const
 }
 
 //Returns the template with the given identification tag
-itype *Item_factory::find_template(Item_tag id)
+itype *Item_factory::find_template( const Item_tag &id )
 {
-    std::map<Item_tag, itype *>::iterator found = m_templates.find(id);
+    const auto found = m_templates.find( id );
     if (found != m_templates.end()) {
         return found->second;
     }
@@ -530,7 +529,7 @@ itype *Item_factory::find_template(Item_tag id)
                                            "  You think it wants to be a %s.", id.c_str());
     bad_itype->sym = '.';
     bad_itype->color = c_white;
-    m_templates[id] = bad_itype;
+    register_itype( bad_itype );
     return bad_itype;
 }
 
@@ -540,6 +539,11 @@ void Item_factory::add_item_type(itype *new_type)
         debugmsg( "called Item_factory::add_item_type with nullptr" );
         return;
     }
+    register_itype( new_type );
+}
+
+void Item_factory::register_itype( itype *new_type )
+{
     auto &entry = m_templates[new_type->id];
     delete entry;
     entry = new_type;
@@ -878,13 +882,9 @@ void Item_factory::load_basic_info(JsonObject &jo, itype *new_item_template)
 {
     std::string new_id = jo.get_string("id");
     new_item_template->id = new_id;
-    if (m_templates.count(new_id) > 0) {
-        // New item already exists. Because mods are loaded after
-        // core data, we override it. This allows mods to change
-        // item from core data.
-        delete m_templates[new_id];
-    }
-    m_templates[new_id] = new_item_template;
+    // If the item already exists, register_itype deletes the old one. Because mods are
+    // loaded after core data, we override it. This allows mods to change item from core data.
+    register_itype( new_item_template );
 
     // And then proceed to assign the correct field
     new_item_template->price = jo.get_int("price");
@@ -1634,10 +1634,12 @@ std::vector<Item_tag> Item_factory::get_all_itype_ids() const
     for( auto & p : m_templates ) {
         result.push_back( p.first );
     }
+    // Sorted, the wish menu shows them in this order.
+    std::sort( result.begin(), result.end() );
     return result;
 }
 
-const std::map<Item_tag, itype *> &Item_factory::get_all_itypes() const
+const std::unordered_map<Item_tag, itype *> &Item_factory::get_all_itypes() const
 {
     return m_templates;
 }
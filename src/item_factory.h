@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <bitset>
 #include <memory>
 
@@ -186,7 +187,7 @@ class Item_factory
          * generated, stored and returned.
          * @param id Item type id (@ref itype::id).
          */
-        itype *find_template( Item_tag id );
+        itype *find_template( const Item_tag &id );
         /**
          * Add a passed in itype to the collection of item types.
          * If the item type overrides an existing type, the existing type is deleted first.
@@ -208,14 +209,19 @@ class Item_factory
          * Key is the item type id (@ref itype::id, the parameter to
          * @ref find_template).
          * Value is the itype instance (result of @ref find_template).
+         * Note that the map is not ordered, use @ref get_all_itype_ids where the order matters.
          */
-        const std::map<Item_tag, itype *> &get_all_itypes() const;
+        const std::unordered_map<Item_tag, itype *> &get_all_itypes() const;
         /**
          * Create a new (and currently unused) item type id.
          */
         Item_tag create_artifact_id() const;
     private:
-        std::map<Item_tag, itype *> m_templates;
+        std::unordered_map<Item_tag, itype *> m_templates;
+        /**
+         * Stores the item type in @ref m_templates, an existing type with the same id is deleted.
+         */
+        void register_itype( itype *new_type );
         typedef std::map<Group_tag, Item_spawn_data *> GroupMap;
         GroupMap m_template_groups;
 
@@ -313,6 +313,7 @@ long unfold_vehicle_iuse::use(player *p, item *it, bool /*t*/, const tripoint &/
                 dst.amount = src.amount;
                 dst.flags = src.flags;
             }
+            veh->invalidate_stats();
         } catch(std::string e) {
             debugmsg("Error restoring vehicle: %s", e.c_str());
         }
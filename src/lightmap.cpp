@@ -113,6 +113,7 @@ void map::build_transparency_cache( const int zlev )
         }
     }
     ch.transparency_cache_dirty = false;
+    ch.los_cache.clear();
 }
 
 void map::apply_character_light( const player &p )
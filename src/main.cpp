@@ -31,6 +31,11 @@
 
 void exit_handler(int s);
 
+#ifdef SDLTILES
+// defined in sdltiles.cpp
+void benchmark_text_rendering(int frames);
+#endif
+
 namespace {
 
 struct arg_handler {
@@ -63,6 +68,9 @@ int main(int argc, char *argv[])
     int seed = time(NULL);
     bool verifyexit = false;
     bool check_all_mods = false;
+#ifdef SDLTILES
+    int render_benchmark_frames = 0;
+#endif
 
     // Set default file paths
 #ifdef PREFIX
@@ -115,6 +123,18 @@ int main(int argc, char *argv[])
                     return 0;
                 }
             },
+#ifdef SDLTILES
+            {
+                "--render-benchmark", "<frames>",
+                "Draws the given number of frames of random text and prints the rendering speed",
+                section_default,
+                [&render_benchmark_frames](int num_args, const char **params) -> int {
+                    if (num_args < 1) return -1;
+                    render_benchmark_frames = atoi(params[0]);
+                    return 1;
+                }
+            },
+#endif
             {
                 "--basepath", "<path>",
                 "Base path for all game data subdirectories",
@@ -382,6 +402,15 @@ int main(int argc, char *argv[])
     // curs_set(0); // Invisible cursor
     set_escdelay(10); // Make escape actually responsive
 
+#ifdef SDLTILES
+    if (render_benchmark_frames > 0) {
+        benchmark_text_rendering(render_benchmark_frames);
+        deinitDebug();
+        endwin();
+        return 0;
+    }
+#endif
+
     std::srand(seed);
 
     g = new game;
@@ -30,6 +30,10 @@
 #include <stdlib.h>
 #include <fstream>
 #include <cstring>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 extern bool is_valid_in_w_terrain(int,int);
 
@@ -200,11 +204,11 @@ void map::reset_vehicle_cache( const int zlev )
     auto &ch = get_cache( zlev );
     ch.veh_in_active_range = false;
     for( const auto & elem : ch.vehicle_list ) {
-        update_vehicle_cache( elem, true );
+        update_vehicle_cache( elem );
     }
 }
 
-void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
+void map::update_vehicle_cache( vehicle *veh )
 {
     if( veh == nullptr ) {
         debugmsg( "Tried to add null vehicle to cache" );
@@ -214,22 +218,16 @@ void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
     auto &ch = get_cache( veh->smz );
     ch.veh_in_active_range = true;
 
-    if( !brand_new ) {
-        // Existing must be cleared
-        auto it = ch.veh_cached_parts.begin();
-        const auto end = ch.veh_cached_parts.end();
-        while( it != end ) {
-            if( it->second.first == veh ) {
-                const auto &p = it->first;
-                if( inbounds( p.x, p.y ) ) {
-                    ch.veh_exists_at[p.x][p.y] = false;
-                }
-                ch.veh_cached_parts.erase( it++ );
-            } else {
-                ++it;
-            }
+    // Only the squares the vehicle occupied before need to be cleared, a brand new
+    // vehicle simply doesn't have any.
+    auto &squares = ch.veh_cached_squares[veh];
+    for( const point &p : squares ) {
+        auto &cached = ch.veh_cached_parts[p.x][p.y];
+        if( cached.first == veh ) {
+            cached = std::make_pair( nullptr, 0 );
         }
     }
+    squares.clear();
     // Get parts
     std::vector<vehicle_part> &parts = veh->parts;
     const tripoint gpos = veh->global_pos3();
@@ -240,10 +238,14 @@ void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
             continue;
         }
         const tripoint p = gpos + it->precalc[0];
-        ch.veh_cached_parts.insert( std::make_pair( p,
-                                    std::make_pair( veh, partid ) ) );
-        if( inbounds( p.x, p.y ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+        if( !inbounds( p.x, p.y ) ) {
+            continue;
+        }
+        // The first part on a square is the one that is cached.
+        auto &cached = ch.veh_cached_parts[p.x][p.y];
+        if( cached.first == nullptr ) {
+            cached = std::make_pair( veh, partid );
+            squares.emplace_back( p.x, p.y );
         }
     }
 }
@@ -251,14 +253,12 @@ void map::update_vehicle_cache( vehicle *veh, const bool brand_new )
 void map::clear_vehicle_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    while( !ch.veh_cached_parts.empty() ) {
-        const auto part = ch.veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = false;
+    for( const auto &elem : ch.veh_cached_squares ) {
+        for( const point &p : elem.second ) {
+            ch.veh_cached_parts[p.x][p.y] = std::make_pair( nullptr, 0 );
         }
-        ch.veh_cached_parts.erase( part );
     }
+    ch.veh_cached_squares.clear();
 }
 
 void map::clear_vehicle_list( const int zlev )
@@ -317,6 +317,8 @@ void map::vehmove()
         VehicleList vehs = get_vehicles();
         for( auto &vehs_v : vehs ) {
             vehicle *veh = vehs_v.v;
+            // Cargo may have changed its type in place, see vehicle::invalidate_stats.
+            veh->invalidate_stats();
             veh->gain_moves();
             veh->slow_leak();
         }
@@ -913,21 +915,10 @@ const vehicle* map::veh_at( const tripoint &p, int &part_num ) const
 const vehicle* map::veh_at_internal( const tripoint &p, int &part_num ) const
 {
     // This function is called A LOT. Move as much out of here as possible.
-    const auto &ch = get_cache( p.z );
-    if( !ch.veh_in_active_range || !ch.veh_exists_at[p.x][p.y] ) {
-        part_num = 0;
-        return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
-    }
-
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
-    }
-
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = 0;
-    return nullptr;
+    // Squares without a vehicle contain (nullptr, 0).
+    const auto &cached = get_cache( p.z ).veh_cached_parts[p.x][p.y];
+    part_num = cached.second;
+    return cached.first;
 }
 
 vehicle* map::veh_at_internal( const tripoint &p, int &part_num )
@@ -989,6 +980,7 @@ void map::board_vehicle( const tripoint &pos, player *p )
     }
     veh->parts[seat_part].set_flag(vehicle_part::passenger_flag);
     veh->parts[seat_part].passenger_id = p->getID();
+    veh->invalidate_stats();
 
     p->setx( pos.x );
     p->sety( pos.y );
@@ -1043,6 +1035,7 @@ void map::unboard_vehicle( const tripoint &p )
     passenger->driving_recoil = 0;
     passenger->controlling_vehicle = false;
     veh->parts[seat_part].remove_flag(vehicle_part::passenger_flag);
+    veh->invalidate_stats();
     veh->skidding = true;
 }
 
@@ -1125,6 +1118,7 @@ bool map::displace_vehicle( tripoint &p, const tripoint &dp, bool test )
                          p.z,
                          g->u.posx(), g->u.posy(), g->u.posz() );
             veh->parts[prt].remove_flag(vehicle_part::passenger_flag);
+            veh->invalidate_stats();
             continue;
         }
         // add recoil
@@ -2265,8 +2259,7 @@ bool map::moppable_items_at( const tripoint &p )
     int vpart;
     vehicle *veh = veh_at(p, vpart);
     if(veh != 0) {
-        std::vector<int> parts_here = veh->parts_at_relative(veh->parts[vpart].mount.x, veh->parts[vpart].mount.y);
-        for(auto &i : parts_here) {
+        for( const int i : veh->parts_at_mount( veh->parts[vpart].mount ) ) {
             if(veh->parts[i].blood > 0) {
                 return true;
             }
@@ -2452,9 +2445,7 @@ void map::mop_spills( const tripoint &p ) {
     int vpart;
     vehicle *veh = veh_at(p, vpart);
     if(veh != 0) {
-        std::vector<int> parts_here = veh->parts_at_relative( veh->parts[vpart].mount.x,
-                                                              veh->parts[vpart].mount.y );
-        for( auto &elem : parts_here ) {
+        for( const int elem : veh->parts_at_mount( veh->parts[vpart].mount ) ) {
             veh->parts[elem].blood = 0;
         }
     }
@@ -3613,15 +3604,7 @@ void map::set_temperature( const int x, const int y, int new_temperature )
 // Items: 2D
 map_stack map::i_at( const int x, const int y )
 {
-    if( !INBOUNDS(x, y) ) {
-        nulitems.clear();
-        return map_stack{ &nulitems, tripoint( x, y, abs_sub.z ), this };
-    }
-
-    int lx, ly;
-    submap *const current_submap = get_submap_at( x, y, lx, ly );
-
-    return map_stack{ &current_submap->itm[lx][ly], tripoint( x, y, abs_sub.z ), this };
+    return i_at( tripoint( x, y, abs_sub.z ) );
 }
 
 std::list<item>::iterator map::i_rem( const point location, std::list<item>::iterator it )
@@ -4187,6 +4170,8 @@ void map::process_items_in_vehicle( vehicle *const cur_veh, submap *const curren
         const tripoint item_location = tripoint( partloc, abs_sub.z );
         auto items = cur_veh->get_items(static_cast<int>(part_index));
         if(!processor(items, active_item.item_iterator, item_location, signal)) {
+            // The item may have been turned into something else.
+            cur_veh->invalidate_stats();
             // If the item was NOT destroyed, we can skip the remainder,
             // which handles fallout from the vehicle being damaged.
             continue;
@@ -5352,12 +5337,178 @@ bool map::sees( const point F, const point T, const int range, int &bresenham_sl
     return sees( F.x, F.y, T.x, T.y, range, bresenham_slope );
 }
 
+static uint64_t los_cache_key( const int Fx, const int Fy, const int Tx, const int Ty )
+{
+    const auto pack = []( int v ) {
+        return static_cast<uint64_t>( static_cast<uint16_t>( v ) );
+    };
+    return pack( Fx ) << 48 | pack( Fy ) << 32 | pack( Tx ) << 16 | pack( Ty );
+}
+
 /*
 map::sees based off code by Steve Register [arns@arns.freeservers.com]
 http://roguebasin.roguelikedevelopment.org/index.php?title=Simple_Line_of_Sight
 */
 bool map::sees(const int Fx, const int Fy, const int Tx, const int Ty,
                const int range, int &bresenham_slope) const
+{
+    if (range >= 0 && range < rl_dist(Fx, Fy, Tx, Ty) ) {
+        bresenham_slope = 0;
+        return false; // Out of range!
+    }
+
+    // Monsters tend to check the same lines over and over (e.g. all of them checking
+    // whether they see the player), so remember the result until the transparency changes.
+    const uint64_t key = los_cache_key( Fx, Fy, Tx, Ty );
+    auto &los_cache = get_cache( abs_sub.z ).los_cache;
+    const auto iter = los_cache.find( key );
+    if( iter != los_cache.end() ) {
+        bresenham_slope = iter->second.second;
+        return iter->second.first;
+    }
+    const bool result = sees_uncached( Fx, Fy, Tx, Ty, bresenham_slope );
+    los_cache[key] = std::make_pair( result, bresenham_slope );
+    return result;
+}
+
+/**
+ * Worker threads for @ref map::precompute_sees. They are started once and wait for work
+ * between turns, they are only restarted when the number of threads is changed.
+ */
+class sight_thread_pool
+{
+    public:
+        ~sight_thread_pool() {
+            stop();
+        }
+
+        /**
+         * Calls work( first, parts ) for every first in [0, parts), the call with first 0
+         * on the calling thread and the others on the workers, and waits for all of them.
+         * @param threads Number of threads including the calling one, parts must not be
+         * larger than that.
+         */
+        void run( const size_t threads, const size_t parts,
+                  const std::function<void( size_t, size_t )> &work ) {
+            if( parts <= 1 ) {
+                work( 0, 1 );
+                return;
+            }
+            if( workers.size() + 1 != threads ) {
+                stop();
+                start( threads - 1 );
+            }
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                job = &work;
+                job_parts = parts;
+                pending = workers.size();
+                generation++;
+            }
+            wake.notify_all();
+            work( 0, parts );
+            std::unique_lock<std::mutex> lock( mutex );
+            done.wait( lock, [this] {
+                return pending == 0;
+            } );
+            job = nullptr;
+        }
+
+    private:
+        void start( const size_t count ) {
+            quit = false;
+            for( size_t i = 0; i < count; i++ ) {
+                // The worker must only pick up jobs posted after this point.
+                workers.emplace_back( &sight_thread_pool::work_loop, this, i + 1, generation );
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                quit = true;
+            }
+            wake.notify_all();
+            for( auto &worker : workers ) {
+                worker.join();
+            }
+            workers.clear();
+        }
+
+        void work_loop( const size_t first, unsigned seen_generation ) {
+            std::unique_lock<std::mutex> lock( mutex );
+            while( true ) {
+                wake.wait( lock, [&] {
+                    return quit || generation != seen_generation;
+                } );
+                if( quit ) {
+                    return;
+                }
+                seen_generation = generation;
+                const auto *const work = job;
+                const size_t parts = job_parts;
+                lock.unlock();
+                if( first < parts ) {
+                    ( *work )( first, parts );
+                }
+                lock.lock();
+                if( --pending == 0 ) {
+                    done.notify_one();
+                }
+            }
+        }
+
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        const std::function<void( size_t, size_t )> *job = nullptr;
+        size_t job_parts = 0;
+        size_t pending = 0;
+        unsigned generation = 0;
+        bool quit = false;
+};
+
+void map::precompute_sees( const std::vector<std::pair<tripoint, tripoint>> &lines,
+                           const int threads ) const
+{
+    static sight_thread_pool pool;
+
+    auto &los_cache = get_cache( abs_sub.z ).los_cache;
+    std::vector<std::pair<tripoint, tripoint>> todo;
+    for( const auto &line : lines ) {
+        const auto &F = line.first;
+        const auto &T = line.second;
+        if( los_cache.count( los_cache_key( F.x, F.y, T.x, T.y ) ) == 0 ) {
+            todo.push_back( line );
+        }
+    }
+
+    // Each thread writes to its own elements only, the cache itself is filled afterwards.
+    std::vector<std::pair<bool, int>> results( todo.size() );
+    const auto check_lines = [&]( const size_t first, const size_t step ) {
+        for( size_t i = first; i < todo.size(); i += step ) {
+            const auto &F = todo[i].first;
+            const auto &T = todo[i].second;
+            results[i].first = sees_uncached( F.x, F.y, T.x, T.y, results[i].second );
+        }
+    };
+    // Waking the workers is not free, don't bother for a handful of lines.
+    static const size_t min_lines_per_thread = 32;
+    const size_t num_threads = std::max( 1, threads );
+    const size_t parts = std::max<size_t>( 1, std::min<size_t>( num_threads,
+                                           todo.size() / min_lines_per_thread ) );
+    pool.run( num_threads, parts, check_lines );
+
+    for( size_t i = 0; i < todo.size(); i++ ) {
+        const auto &F = todo[i].first;
+        const auto &T = todo[i].second;
+        los_cache[los_cache_key( F.x, F.y, T.x, T.y )] = results[i];
+    }
+}
+
+bool map::sees_uncached( const int Fx, const int Fy, const int Tx, const int Ty,
+                         int &bresenham_slope ) const
 {
     const int dx = Tx - Fx;
     const int dy = Ty - Fy;
@@ -5370,10 +5521,6 @@ bool map::sees(const int Fx, const int Fy, const int Tx, const int Ty,
     int t = 0;
     int st;
 
-    if (range >= 0 && range < rl_dist(Fx, Fy, Tx, Ty) ) {
-        bresenham_slope = 0;
-        return false; // Out of range!
-    }
     if (ax > ay) { // Mostly-horizontal line
         st = SGN(ay - (ax / 2));
         // Doing it "backwards" prioritizes straight lines before diagonal.
@@ -5885,7 +6032,7 @@ void map::loadn( const int gridx, const int gridy, const int gridz, const bool u
             // Only add if not tracking already.
             if( ch.vehicle_list.find( it ) == ch.vehicle_list.end() ) {
                 ch.vehicle_list.insert( it );
-                update_vehicle_cache( it, gridz );
+                update_vehicle_cache( it );
             }
         }
     }
@@ -5941,6 +6088,10 @@ void map::remove_rotten_items( Container &items, const tripoint &pnt )
 
 void map::fill_funnels( const tripoint &p )
 {
+    // TODO: Z-level weather, there's no rain below ground
+    if( p.z < 0 ) {
+        return;
+    }
     const auto &tr = tr_at( p );
     if( !tr.is_funnel() ) {
         return;
@@ -5958,7 +6109,6 @@ void map::fill_funnels( const tripoint &p )
         }
     }
     if( biggest_container != items.end() ) {
-
         retroactively_fill_from_funnel( *biggest_container, tr, calendar::turn, getabs( p ) );
     }
 }
@@ -6978,7 +7128,8 @@ level_cache::level_cache()
     transparency_cache_dirty = true;
     outside_cache_dirty = true;
     veh_in_active_range = false;
-    std::fill_n( &veh_exists_at[0][0], SEEX * MAPSIZE * SEEY * MAPSIZE, false );
+    std::fill_n( &veh_cached_parts[0][0], SEEX * MAPSIZE * SEEY * MAPSIZE,
+                 std::make_pair( nullptr, 0 ) );
 }
 
 void map::clip_to_bounds( tripoint &p ) const
@@ -10,6 +10,7 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <cstdint>
 
 #include "game_constants.h"
 #include "mapdata.h"
@@ -116,10 +117,19 @@ struct level_cache {
     float transparency_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
     bool seen_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
     lit_level visibility_cache[MAPSIZE*SEEX][MAPSIZE*SEEY];
+    /**
+     * Results of @ref map::sees (visible and bresenham slope), keyed by the packed
+     * from/to coordinates. The result only depends on @ref transparency_cache,
+     * so this is cleared whenever that one is marked dirty or rebuilt, and at the
+     * start of every turn (see @ref map::clear_los_cache).
+     */
+    mutable std::unordered_map<uint64_t, std::pair<bool, int>> los_cache;
 
     bool veh_in_active_range;
-    bool veh_exists_at[SEEX * MAPSIZE][SEEY * MAPSIZE];
-    std::map< tripoint, std::pair<vehicle*,int> > veh_cached_parts;
+    /** Vehicle and index of its (first) part on each square, nullptr if there is none. */
+    std::pair<vehicle *, int> veh_cached_parts[SEEX * MAPSIZE][SEEY * MAPSIZE];
+    /** The squares of @ref veh_cached_parts each vehicle occupies, to clear them when it moves. */
+    std::unordered_map<const vehicle *, std::vector<point>> veh_cached_squares;
     std::set<vehicle*> vehicle_list;
 };
 
@@ -170,6 +180,17 @@ class map
     void set_transparency_cache_dirty( const int zlev ) {
         if( inbounds_z( zlev ) ) {
             get_cache( zlev ).transparency_cache_dirty = true;
+            get_cache( zlev ).los_cache.clear();
+        }
+    }
+
+    /**
+     * Drops the results remembered by @ref sees on all z-levels. Monsters check new lines
+     * whenever they move, so this is done once per turn to keep the memo from growing.
+     */
+    void clear_los_cache() {
+        for( auto &ptr : caches ) {
+            ptr->los_cache.clear();
         }
     }
 
@@ -346,6 +367,20 @@ public:
     */
     bool sees( const tripoint &F, const tripoint &T, int range, int &t1, int &t2 ) const;
     bool sees( const tripoint &F, const tripoint &T, int range ) const;
+    /**
+     * Does the line of sight checks of @ref sees for all the given (from, to) pairs and
+     * stores the results, so later calls to sees with those points don't have to.
+     * The checks don't modify anything and can be split among several threads, which
+     * is the point of this function. Like with sees, the z component is ignored.
+     * @param threads Number of threads to use, 1 does all of it on the calling thread.
+     * The worker threads are kept running between calls.
+     */
+    void precompute_sees( const std::vector<std::pair<tripoint, tripoint>> &lines,
+                          int threads ) const;
+ private:
+    /** Does the actual (uncached) line of sight check for @ref sees, ignoring the range. */
+    bool sees_uncached( int Fx, int Fy, int Tx, int Ty, int &bresenham_slope ) const;
+ public:
 
  /**
   * Check whether there's a direct line of sight between `(Fx, Fy)` and
@@ -401,7 +436,7 @@ public:
  int coord_to_angle(const int x, const int y, const int tgtx, const int tgty) const;
 // Vehicles: Common to 2D and 3D
     VehicleList get_vehicles();
-    void update_vehicle_cache(vehicle *, const bool brand_new = false);
+    void update_vehicle_cache( vehicle * );
     void reset_vehicle_cache( const int zlev );
     void clear_vehicle_cache( const int zlev );
     void clear_vehicle_list( const int zlev );
@@ -727,6 +762,14 @@ void add_corpse( const tripoint &p );
 // Items: 3D
     // Accessor that returns a wrapped reference to an item stack for safe modification.
     map_stack i_at( const tripoint &p );
+    /**
+     * Try to fill funnel based items here. Funnels are not filled while it rains,
+     * this applies the rain accumulated since the last call. It is done when the
+     * submap is loaded and whenever the items on the tile are looked at, listed,
+     * examined, picked up, moved or gathered for crafting.
+     * @param p The location in this map where to fill funnels.
+     */
+    void fill_funnels( const tripoint &p );
     item water_from( const tripoint &p );
     item swater_from( const tripoint &p );
     void i_clear( const tripoint &p );
@@ -1051,11 +1094,6 @@ protected:
          */
         template <typename Container>
         void remove_rotten_items( Container &items, const tripoint &p );
-        /**
-         * Try to fill funnel based items here.
-         * @param pnt The location in this map where to fill funnels.
-         */
-        void fill_funnels( const tripoint &p );
         /**
          * Try to grow a harvestable plant to the next stage(s).
          */
@@ -11593,7 +11593,7 @@ vehicle *map::add_vehicle(const vproto_id & type, const int x, const int y, cons
 
         auto &ch = get_cache( placed_vehicle->smz );
         ch.vehicle_list.insert(placed_vehicle);
-        update_vehicle_cache(placed_vehicle, true);
+        update_vehicle_cache(placed_vehicle);
 
         //debugmsg ("grid[%d]->vehicles.size=%d veh.parts.size=%d", nonant, grid[nonant]->vehicles.size(),veh.parts.size());
     }
@@ -374,7 +374,7 @@ void finialize_martial_arts()
         const ma_buff_effect_type new_eff( buff.second );
         // Note the slicing here: new_eff is converted to a plain effect_type, but this doesn't
         // bother us because ma_buff_effect_type does not have any members that can be sliced.
-        effect_types[new_eff.id] = new_eff;
+        register_effect_type( new_eff );
     }
 }
 
@@ -811,10 +811,8 @@ template<typename C, typename F>
 static void accumulate_ma_buff_effects( const C &container, F f )
 {
     for( auto &elem : container ) {
-        for( auto &eff : elem.second ) {
-            if( auto buff = ma_buff::from_effect( eff.second ) ) {
-                f( *buff, eff.second );
-            }
+        if( auto buff = ma_buff::from_effect( elem.second ) ) {
+            f( *buff, elem.second );
         }
     }
 }
@@ -823,11 +821,9 @@ template<typename C, typename F>
 static bool search_ma_buff_effect( const C &container, F f )
 {
     for( auto &elem : container ) {
-        for( auto &eff : elem.second ) {
-            if( auto buff = ma_buff::from_effect( eff.second ) ) {
-                if( f( *buff, eff.second ) ) {
-                    return true;
-                }
+        if( auto buff = ma_buff::from_effect( elem.second ) ) {
+            if( f( *buff, elem.second ) ) {
+                return true;
             }
         }
     }
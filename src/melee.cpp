@@ -17,6 +17,7 @@
 #include <sstream>
 #include <stdlib.h>
 #include <algorithm>
+#include <limits>
 
 #include "cursesdef.h"
 
@@ -6,6 +6,9 @@
 
 std::unordered_map< mfaction_str_id, mfaction_id > faction_map;
 std::vector< monfaction > faction_list;
+// Factions are only ever added, so resolved ids stay valid. This is here for the cached
+// int ids in mfaction_str_id (see string_id::_version), change it if factions get removed.
+static const int faction_map_version = 0;
 
 void add_to_attitude_map( const std::set< std::string > &keys, mfaction_att_map &map,
                           mf_attitude value );
@@ -32,11 +35,16 @@ const string_id<monfaction> &int_id<monfaction>::id() const
 template<>
 int_id<monfaction> string_id<monfaction>::id() const
 {
+    if( _version == faction_map_version ) {
+        return mfaction_id( _cid );
+    }
     const auto &iter = faction_map.find( *this );
     if( iter == faction_map.end() ) {
         debugmsg( "invalid monfaction id %s", c_str() );
         return mfaction_id( 0 );
     }
+    _cid = iter->second.to_i();
+    _version = faction_map_version;
     return iter->second;
 }
 
@@ -49,7 +57,7 @@ const monfaction &string_id<monfaction>::obj() const
 template<>
 bool string_id<monfaction>::is_valid() const
 {
-    return faction_map.count( *this ) > 0;
+    return _version == faction_map_version || faction_map.count( *this ) > 0;
 }
 
 template<>
@@ -23,6 +23,9 @@
 
 #define MONSTER_FOLLOW_DIST 8
 
+static const effect_type_handle effect_stunned( "stunned" );
+static const effect_type_handle effect_docile( "docile" );
+
 bool monster::wander()
 {
     return ( plans.empty() );
@@ -142,13 +145,17 @@ void monster::plan( const mfactions &factions )
     int bresen2 = 0; // Unused until FoV update
     int selected_slope = 0;
     bool fleeing = false;
-    bool docile = has_flag( MF_VERMIN ) || ( friendly != 0 && has_effect( "docile" ) );
+    bool docile = has_flag( MF_VERMIN ) || ( friendly != 0 && has_effect( effect_docile ) );
     bool angers_hostile_weak = type->anger.find( MTRIG_HOSTILE_WEAK ) != type->anger.end();
     int angers_hostile_near = ( type->anger.find( MTRIG_HOSTILE_CLOSE ) != type->anger.end() ) ? 5 : 0;
     int fears_hostile_near = ( type->fear.find( MTRIG_HOSTILE_CLOSE ) != type->fear.end() ) ? 5 : 0;
     bool group_morale = has_flag( MF_GROUP_MORALE ) && morale < type->morale;
     bool swarms = has_flag( MF_SWARMS );
     auto mood = attitude();
+    // rate_target rates anything we can't see as INT_MAX, so only monsters within this
+    // distance need to be considered at all.
+    const int max_sight = max_sight_distance();
+    const std::vector<int> nearby = g->mons_in_range( pos3(), max_sight );
 
     // If we can see the player, move toward them or flee.
     if( friendly == 0 && sees( g->u, bresenham_slope ) ) {
@@ -162,7 +169,7 @@ void monster::plan( const mfactions &factions )
         }
     } else if( friendly != 0 && !docile ) {
         // Target unfriendly monsters, only if we aren't interacting with the player.
-        for( int i = 0, numz = g->num_zombies(); i < numz; i++ ) {
+        for( const int i : nearby ) {
             monster &tmp = g->zombie( i );
             if( tmp.friendly == 0 ) {
                 float rating = rate_target( tmp, bresenham_slope, bresen2, dist, electronic );
@@ -178,7 +185,10 @@ void monster::plan( const mfactions &factions )
     if( !docile ) {
         for( size_t i = 0; i < g->active_npc.size(); i++ ) {
             npc *me = g->active_npc[i];
-            float rating = rate_target( *me, bresenham_slope, bresen2, dist, electronic );
+            float rating = INT_MAX;
+            if( rl_dist( pos3(), me->pos3() ) <= max_sight ) {
+                rating = rate_target( *me, bresenham_slope, bresen2, dist, electronic );
+            }
             bool fleeing_from = is_fleeing( *me );
             // Switch targets if closer and hostile or scarier than current target
             if( ( rating < dist && fleeing ) ||
@@ -204,7 +214,10 @@ void monster::plan( const mfactions &factions )
                 continue;
             }
 
-            for( int i : fac.second ) { // mon indices
+            for( const int i : nearby ) {
+                if( fac.second.count( i ) == 0 ) {
+                    continue;
+                }
                 monster &mon = g->zombie( i );
                 float rating = rate_target( mon, bresenham_slope, bresen2, dist, electronic );
                 if( rating < dist ) {
@@ -232,7 +245,10 @@ void monster::plan( const mfactions &factions )
     }
     swarms = swarms && target == nullptr; // Only swarm if we have no target
     if( group_morale || swarms ) {
-        for( const int i : myfaction_iter->second ) {
+        for( const int i : nearby ) {
+            if( myfaction_iter->second.count( i ) == 0 ) {
+                continue;
+            }
             monster &mon = g->zombie( i );
             float rating = rate_target( mon, bresenham_slope, bresen2, dist, electronic );
             if( group_morale && rating <= 10 ) {
@@ -346,7 +362,7 @@ void monster::move()
         moves = 0;
         return;
     }
-    if( has_effect( "stunned" ) ) {
+    if( has_effect( effect_stunned ) ) {
         stumble( false );
         moves = 0;
         return;
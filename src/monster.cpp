@@ -27,6 +27,11 @@
 #define SGN(a) (((a)<0) ? -1 : 1)
 #define SQR(a) ((a)*(a))
 
+static const effect_type_handle effect_stunned( "stunned" );
+static const effect_type_handle effect_downed( "downed" );
+static const effect_type_handle effect_webbed( "webbed" );
+static const effect_type_handle effect_docile( "docile" );
+
 monster::monster()
 {
  position.x = 20;
@@ -329,9 +334,9 @@ int monster::print_info(WINDOW* w, int vStart, int vLines, int column) const
     get_Attitude(color, attitude);
     wprintz(w, color, "%s", attitude.c_str());
 
-    if (has_effect("downed")) {
+    if (has_effect(effect_downed)) {
         wprintz(w, h_white, _("On ground"));
-    } else if (has_effect("stunned")) {
+    } else if (has_effect(effect_stunned)) {
         wprintz(w, h_white, _("Stunned"));
     } else if (has_effect("lightsnare") || has_effect("heavysnare") || has_effect("beartrap")) {
         wprintz(w, h_white, _("Trapped"));
@@ -393,7 +398,7 @@ bool monster::is_symbol_highlighted() const
 nc_color monster::color_with_effects() const
 {
     nc_color ret = type->color;
-    if (has_effect("beartrap") || has_effect("stunned") || has_effect("downed") || has_effect("tied") ||
+    if (has_effect("beartrap") || has_effect(effect_stunned) || has_effect(effect_downed) || has_effect("tied") ||
           has_effect("lightsnare") || has_effect("heavysnare")) {
         ret = hilite(ret);
     }
@@ -453,7 +458,7 @@ bool monster::can_act() const
 {
     return moves > 0 && !has_flag(MF_IMMOBILE) &&
         ( effects.empty() ||
-          ( !has_effect("stunned") && !has_effect("downed") && !has_effect("webbed") ) );
+          ( !has_effect(effect_stunned) && !has_effect(effect_downed) && !has_effect(effect_webbed) ) );
 }
 
 
@@ -604,7 +609,7 @@ Creature::Attitude monster::attitude_to( const Creature &other ) const
 monster_attitude monster::attitude(player *u) const
 {
     if( friendly != 0 ) {
-        if( has_effect( "docile" ) ) {
+        if( has_effect( effect_docile ) ) {
             return MATT_FPASSIVE;
         }
         if( u == &g->u ) {
@@ -1123,15 +1128,15 @@ bool monster::move_effects()
     if (has_effect("tied")) {
         return false;
     }
-    if (has_effect("downed")) {
+    if (has_effect(effect_downed)) {
         remove_effect("downed");
         if (u_see_me) {
             add_msg(_("The %s climbs to it's feet!"), name().c_str());
         }
         return false;
     }
-    if (has_effect("webbed")) {
-        if (x_in_y(type->melee_dice * type->melee_sides, 6 * get_effect_int("webbed"))) {
+    if (has_effect(effect_webbed)) {
+        if (x_in_y(type->melee_dice * type->melee_sides, 6 * get_effect_int(effect_webbed))) {
             if (u_see_me) {
                 add_msg(_("The %s breaks free of the webs!"), name().c_str());
             }
@@ -1244,7 +1249,7 @@ int monster::hit_roll() const {
 
 int monster::get_dodge() const
 {
-    if (has_effect("downed")) {
+    if (has_effect(effect_downed)) {
         return 0;
     }
     int ret = type->sk_dodge;
@@ -1553,31 +1558,29 @@ void monster::process_effects()
     // Monster only effects
     int mod = 1;
     for( auto &elem : effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            // Monsters don't get trait-based reduction, but they do get effect based reduction
-            bool reduced = has_effect(it.get_resist_effect());
+        auto &it = elem.second;
+        // Monsters don't get trait-based reduction, but they do get effect based reduction
+        bool reduced = has_effect(it.get_resist_effect());
 
-            mod_speed_bonus(it.get_mod("SPEED", reduced));
+        mod_speed_bonus(it.get_mod("SPEED", reduced));
 
-            int val = it.get_mod("HURT", reduced);
-            if (val > 0) {
-                if(it.activated(calendar::turn, "HURT", val, reduced, mod)) {
-                    apply_damage(nullptr, bp_torso, val);
-                }
+        int val = it.get_mod("HURT", reduced);
+        if (val > 0) {
+            if(it.activated(calendar::turn, "HURT", val, reduced, mod)) {
+                apply_damage(nullptr, bp_torso, val);
             }
+        }
 
-            std::string id = _effect_it.second.get_id();
-            // MATERIALS-TODO: use fire resistance
-            if (id == "onfire") {
-                if (made_of("flesh") || made_of("iflesh"))
-                    apply_damage( nullptr, bp_torso, rng( 3, 8 ) );
-                if (made_of("veggy"))
-                    apply_damage( nullptr, bp_torso, rng( 10, 20 ) );
-                if (made_of("paper") || made_of("powder") || made_of("wood") || made_of("cotton") ||
-                    made_of("wool"))
-                    apply_damage( nullptr, bp_torso, rng( 15, 40 ) );
-            }
+        const std::string &id = it.get_id();
+        // MATERIALS-TODO: use fire resistance
+        if (id == "onfire") {
+            if (made_of("flesh") || made_of("iflesh"))
+                apply_damage( nullptr, bp_torso, rng( 3, 8 ) );
+            if (made_of("veggy"))
+                apply_damage( nullptr, bp_torso, rng( 10, 20 ) );
+            if (made_of("paper") || made_of("powder") || made_of("wood") || made_of("cotton") ||
+                made_of("wool"))
+                apply_damage( nullptr, bp_torso, rng( 15, 40 ) );
         }
     }
 
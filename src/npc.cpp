@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <string>
+#include <limits>
 
 std::vector<item> starting_clothes(npc_class type, bool male);
 std::list<item> starting_inv(npc *me, npc_class type);
@@ -516,7 +516,7 @@ void npc::choose_monster_target(int &enemy, int &danger,
     int highest_priority = 0;
     total_danger = 0;
 
-    for (size_t i = 0; i < g->num_zombies(); i++) {
+    for( const int i : g->mons_in_range( pos(), max_sight_distance() ) ) {
         monster *mon = &(g->zombie(i));
         if( !sees( *mon ) ) {
             continue;
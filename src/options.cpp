@@ -24,6 +24,9 @@
 bool trigdist;
 bool use_tiles;
 
+int options_generation = 0;
+static std::vector<std::function<void()>> options_listeners;
+
 bool used_tiles_changed;
 #ifdef SDLTILES
 extern cata_tiles *tilecontext;
@@ -310,6 +313,7 @@ int cOpt::getItemPos(const std::string sSearch)
 //set to next item
 void cOpt::setNext()
 {
+    options_generation++;
     if (sType == "string") {
         int iNext = getItemPos(sSet) + 1;
         if (iNext >= (int)vItems.size()) {
@@ -338,6 +342,7 @@ void cOpt::setNext()
 //set to prev item
 void cOpt::setPrev()
 {
+    options_generation++;
     if (sType == "string") {
         int iPrev = getItemPos(sSet) - 1;
         if (iPrev < 0) {
@@ -366,6 +371,7 @@ void cOpt::setPrev()
 //set value
 void cOpt::setValue(float fSetIn)
 {
+    options_generation++;
     if (sType != "float") {
         debugmsg("tried to set a float value to a %s option", sType.c_str());
         return;
@@ -379,6 +385,7 @@ void cOpt::setValue(float fSetIn)
 //set value
 void cOpt::setValue(std::string sSetIn)
 {
+    options_generation++;
     if (sType == "string") {
         if (getItemPos(sSetIn) != -1) {
             sSet = sSetIn;
@@ -455,9 +462,23 @@ bool cOpt::operator!=(const std::string sCompare) const
     return !(*this == sCompare);
 }
 
+void add_options_listener( std::function<void()> listener )
+{
+    options_listeners.push_back( listener );
+}
+
+void options_changed()
+{
+    options_generation++;
+    for( auto &listener : options_listeners ) {
+        listener();
+    }
+}
+
 void initOptions()
 {
     OPTIONS.clear();
+    options_generation++;
     ACTIVE_WORLD_OPTIONS.clear();
     vPages.clear();
     mPageItems.clear();
@@ -555,6 +576,13 @@ void initOptions()
 
     mOptionsSort["general"]++;
 
+    OPTIONS["MONSTER_PLANNING_THREADS"] = cOpt("general", _("Monster planning threads"),
+                                              _("Number of threads used to check what monsters can see at the start of their turn. With 1, everything is done on the main thread."),
+                                              1, 16, 2
+                                             );
+
+    mOptionsSort["general"]++;
+
     OPTIONS["CIRCLEDIST"] = cOpt("general", _("Circular distances"),
                                  _("If true, the game will calculate range in a realistic way: light sources will be circles diagonal movement will cover more ground and take longer. If disabled, everything is square: moving to the northwest corner of a building takes as long as moving to the north wall."),
                                  false
@@ -1319,6 +1347,7 @@ void show_options(bool ingame)
             if (ingame && bWorldStuffChanged) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            options_changed();
         }
     }
     if( lang_changed ) {
@@ -1395,6 +1424,7 @@ void load_options()
 
     trigdist = OPTIONS["CIRCLEDIST"]; // cache to global due to heavy usage.
     use_tiles = OPTIONS["USE_TILES"]; // cache to global due to heavy usage.
+    options_changed();
 }
 
 std::string options_header()
@@ -1449,6 +1479,7 @@ void save_options(bool ingame)
     }
     trigdist = OPTIONS["CIRCLEDIST"]; // update trigdist as well
     use_tiles = OPTIONS["USE_TILES"]; // and use_tiles
+    options_changed();
 }
 
 bool use_narrow_sidebar()
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <vector>
 #include <algorithm> //atoi
+#include <functional>
 
 enum copt_hide_t {
     COPT_NO_HIDE,
@@ -130,6 +131,72 @@ extern std::unordered_map<std::string, cOpt> ACTIVE_WORLD_OPTIONS;
 extern std::map<int, std::vector<std::string> > mPageItems;
 extern int iWorldOptPage;
 
+/**
+ * Incremented whenever any option value may have changed, be it through the
+ * cOpt setters or by replacing OPTIONS / ACTIVE_WORLD_OPTIONS as a whole.
+ * @ref option compares against it to know when its cached value is stale.
+ */
+extern int options_generation;
+
+/**
+ * Register a function that is called after the options have been (re)loaded,
+ * saved, reverted or the active world (and thereby its options) has changed.
+ * Use it to refresh caches derived from option values.
+ */
+void add_options_listener( std::function<void()> listener );
+/** Invalidates all @ref option handles and runs the registered listeners. */
+void options_changed();
+
+/**
+ * Typed handle to a single option, meant for code that reads an option often
+ * (every turn or every redraw). Declare it once, e.g. as a function local static:
+ *
+ *     static const option<bool> autosave( "AUTOSAVE" );
+ *     if( autosave ) ...
+ *
+ * Reading it only compares @ref options_generation and returns the cached
+ * value, the option is looked up and converted again only after a change.
+ * The conversion is the same as casting the cOpt (`static_cast<T>( OPTIONS[name] )`),
+ * for std::string the value of @ref cOpt::getValue is returned.
+ * World options (ACTIVE_WORLD_OPTIONS) can be used by passing that map as second
+ * argument, but as with direct access, make sure the map is not empty.
+ */
+template<typename T>
+class option
+{
+    public:
+        option( const std::string &name,
+                std::unordered_map<std::string, cOpt> &source = OPTIONS )
+            : name( name ), source( &source ) {}
+
+        const T &get() const {
+            if( generation != options_generation ) {
+                value = convert( ( *source )[name] );
+                generation = options_generation;
+            }
+            return value;
+        }
+        operator const T &() const {
+            return get();
+        }
+
+    private:
+        static T convert( cOpt &opt ) {
+            return static_cast<T>( opt );
+        }
+
+        std::string name;
+        std::unordered_map<std::string, cOpt> *source;
+        mutable T value = T();
+        mutable int generation = -1;
+};
+
+template<>
+inline std::string option<std::string>::convert( cOpt &opt )
+{
+    return opt.getValue();
+}
+
 extern options_data optionsdata;
 void initOptions();
 void load_options();
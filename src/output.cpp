@@ -1764,7 +1764,8 @@ void scrollingcombattext::add(const int p_iPosX, const int p_iPosY, direction p_
                               const std::string p_sText2, const game_message_type p_gmt2,
                               const std::string p_sType)
 {
-    if (OPTIONS["ANIMATION_SCT"]) {
+    static const option<bool> opt_animation_sct( "ANIMATION_SCT" );
+    if (opt_animation_sct) {
         int iCurStep = 0;
 
         if (p_sType == "hp") {
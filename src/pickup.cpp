@@ -204,43 +204,37 @@ static bool select_autopickup_items( std::vector<item> &here, std::vector<bool>
 {
     bool bFoundSomething = false;
 
-    //Loop through Items lowest Volume first
-    bool bPickup = false;
-
-    for(size_t iVol = 0, iNumChecked = 0; iNumChecked < here.size(); iVol++) {
-        for (size_t i = 0; i < here.size(); i++) {
-            bPickup = false;
-            if (here[i].volume() == (int)iVol) {
-                iNumChecked++;
-                const std::string sItemName = here[i].tname( 1, false );
-
-                //Auto Pickup all items with 0 Volume and Weight <= AUTO_PICKUP_ZERO * 50
-                if (OPTIONS["AUTO_PICKUP_ZERO"]) {
-                    if (here[i].volume() == 0 &&
-                        here[i].weight() <= OPTIONS["AUTO_PICKUP_ZERO"] * 50 &&
-                        checkExcludeRules(sItemName)) {
-                        bPickup = true;
-                    }
-                }
-
-                //Check the Pickup Rules
-                if ( mapAutoPickupItems[sItemName] == "true" ) {
-                    bPickup = true;
-                } else if ( mapAutoPickupItems[sItemName] != "false" ) {
-                    //No prematched pickup rule found
-                    //items with damage, (fits) or a container
-                    createPickupRules(sItemName);
-
-                    if ( mapAutoPickupItems[sItemName] == "true" ) {
-                        bPickup = true;
-                    }
-                }
+    // The verdict of each item only depends on the item itself, so a single
+    // pass over the pile is enough.
+    const int iPickupZero = static_cast<int>( OPTIONS["AUTO_PICKUP_ZERO"] );
+    for (size_t i = 0; i < here.size(); i++) {
+        bool bPickup = false;
+        const std::string sItemName = here[i].tname( 1, false );
+
+        //Auto Pickup all items with 0 Volume and Weight <= AUTO_PICKUP_ZERO * 50
+        if (iPickupZero) {
+            if (here[i].volume() == 0 &&
+                here[i].weight() <= iPickupZero * 50 &&
+                checkExcludeRules(sItemName)) {
+                bPickup = true;
             }
+        }
 
-            if (bPickup) {
-                getitem[i] = bPickup;
-                bFoundSomething = true;
-            }
+        //Check the Pickup Rules
+        auto iter = mapAutoPickupItems.find( sItemName );
+        if ( iter == mapAutoPickupItems.end() ) {
+            //No prematched pickup rule found
+            //items with damage, (fits) or a container
+            createPickupRules(sItemName);
+            iter = mapAutoPickupItems.find( sItemName );
+        }
+        if ( iter != mapAutoPickupItems.end() && iter->second == "true" ) {
+            bPickup = true;
+        }
+
+        if (bPickup) {
+            getitem[i] = bPickup;
+            bFoundSomething = true;
         }
     }
     return bFoundSomething;
@@ -470,6 +464,7 @@ void Pickup::pick_up( const tripoint &pos, int min )
     }
 
     if( !from_vehicle ) {
+        g->m.fill_funnels( pos );
         bool isEmpty = (g->m.i_at(pos).empty());
 
         // Hide the pickup window if this is a toilet and there's nothing here
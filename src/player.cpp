@@ -61,6 +61,7 @@ static const std::string header_spaces(26, ' ');
 stats player_stats;
 
 static const itype_id OPTICAL_CLOAK_ITEM_ID( "optical_cloak" );
+static const effect_type_handle effect_sleep( "sleep" );
 
 namespace {
     const std::string &get_morale_data( const morale_type id )
@@ -802,7 +803,7 @@ void player::update_bodytemp()
     int total_windpower = get_local_windpower(weather.windpower + vehwindspeed, omtername, sheltered);
     // Temperature norms
     // Ambient normal temperature is lower while asleep
-    int ambient_norm = (has_effect("sleep") ? 3100 : 1900);
+    int ambient_norm = (has_effect(effect_sleep) ? 3100 : 1900);
     // This gets incremented in the for loop and used in the morale calculation
     int morale_pen = 0;
     const trap &trap_at_pos = g->m.tr_at(pos());
@@ -942,7 +943,7 @@ void player::update_bodytemp()
         // HUNGER
         temp_conv[i] -= hunger / 6 + 100;
         // FATIGUE
-        if( !has_effect("sleep") ) {
+        if( !has_effect(effect_sleep) ) {
             temp_conv[i] -= std::max(0.0, 1.5 * fatigue);
         }
         // CONVECTION HEAT SOURCES (generates body heat, helps fight frostbite)
@@ -1543,12 +1544,10 @@ void player::recalc_speed_bonus()
 
     mod_speed_bonus(stim > 40 ? 40 : stim);
 
-    for (auto maps : effects) {
-        for (auto i : maps.second) {
-            bool reduced = has_trait(i.second.get_resist_trait()) ||
-                            has_effect(i.second.get_resist_effect());
-            mod_speed_bonus(i.second.get_mod("SPEED", reduced));
-        }
+    for( auto &elem : effects ) {
+        bool reduced = has_trait(elem.second.get_resist_trait()) ||
+                        has_effect(elem.second.get_resist_effect());
+        mod_speed_bonus(elem.second.get_mod("SPEED", reduced));
     }
 
     // add martial arts speed bonus
@@ -2340,12 +2339,10 @@ void player::disp_info()
     std::vector<std::string> effect_text;
     std::string tmp = "";
     for( auto &elem : effects ) {
-        for( auto &_effect_it : elem.second ) {
-            tmp = _effect_it.second.disp_name();
-            if (tmp != "") {
-                effect_name.push_back( tmp );
-                effect_text.push_back( _effect_it.second.disp_desc() );
-            }
+        tmp = elem.second.disp_name();
+        if (tmp != "") {
+            effect_name.push_back( tmp );
+            effect_text.push_back( elem.second.disp_desc() );
         }
     }
     if (abs(morale_level()) >= 100) {
@@ -2844,14 +2841,12 @@ Strength - 4;    Dexterity - 4;    Intelligence - 4;    Perception - 4"));
     std::map<std::string, int> speed_effects;
     std::string dis_text = "";
     for( auto &elem : effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            bool reduced = has_trait(it.get_resist_trait()) || has_effect(it.get_resist_effect());
-            int move_adjust = it.get_mod("SPEED", reduced);
-            if (move_adjust != 0) {
-                dis_text = it.get_speed_name();
-                speed_effects[dis_text] += move_adjust;
-            }
+        auto &it = elem.second;
+        bool reduced = has_trait(it.get_resist_trait()) || has_effect(it.get_resist_effect());
+        int move_adjust = it.get_mod("SPEED", reduced);
+        if (move_adjust != 0) {
+            dis_text = it.get_speed_name();
+            speed_effects[dis_text] += move_adjust;
         }
     }
 
@@ -5663,7 +5658,7 @@ void player::cough(bool harmful, int loudness) {
     if (harmful && !one_in(4)) {
         apply_damage( nullptr, bp_torso, 1 );
     }
-    if (has_effect("sleep") && ((harmful && one_in(3)) || one_in(10)) ) {
+    if (has_effect(effect_sleep) && ((harmful && one_in(3)) || one_in(10)) ) {
         wake_up();
     }
 }
@@ -5826,195 +5821,193 @@ void player::process_effects() {
 
     //Human only effects
     for( auto &elem : effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            bool reduced = has_trait(it.get_resist_trait()) || has_effect(it.get_resist_effect());
-            double mod = 1;
-            body_part bp = it.get_bp();
-            int val = 0;
+        auto &it = elem.second;
+        bool reduced = has_trait(it.get_resist_trait()) || has_effect(it.get_resist_effect());
+        double mod = 1;
+        body_part bp = it.get_bp();
+        int val = 0;
 
-            // Still hardcoded stuff, do this first since some modify their other traits
-            hardcoded_effects(it);
+        // Still hardcoded stuff, do this first since some modify their other traits
+        hardcoded_effects(it);
 
-            // Handle miss messages
-            auto msgs = it.get_miss_msgs();
-            if (!msgs.empty()) {
-                for (auto i : msgs) {
-                    add_miss_reason(_(i.first.c_str()), i.second);
-                }
+        // Handle miss messages
+        auto msgs = it.get_miss_msgs();
+        if (!msgs.empty()) {
+            for (auto i : msgs) {
+                add_miss_reason(_(i.first.c_str()), i.second);
             }
+        }
 
-            // Handle health mod
-            val = it.get_mod("H_MOD", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "H_MOD", val, reduced, mod)) {
-                    mod_healthy_mod(bound_mod_to_vals(get_healthy_mod(), val,
-                                it.get_max_val("H_MOD", reduced), it.get_min_val("H_MOD", reduced)));
-                }
+        // Handle health mod
+        val = it.get_mod("H_MOD", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "H_MOD", val, reduced, mod)) {
+                mod_healthy_mod(bound_mod_to_vals(get_healthy_mod(), val,
+                            it.get_max_val("H_MOD", reduced), it.get_min_val("H_MOD", reduced)));
             }
+        }
 
-            // Handle health
-            val = it.get_mod("HEALTH", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "HEALTH", val, reduced, mod)) {
-                    mod_healthy(bound_mod_to_vals(get_healthy(), val,
-                                it.get_max_val("HEALTH", reduced), it.get_min_val("HEALTH", reduced)));
-                }
+        // Handle health
+        val = it.get_mod("HEALTH", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "HEALTH", val, reduced, mod)) {
+                mod_healthy(bound_mod_to_vals(get_healthy(), val,
+                            it.get_max_val("HEALTH", reduced), it.get_min_val("HEALTH", reduced)));
             }
+        }
 
-            // Handle stim
-            val = it.get_mod("STIM", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "STIM", val, reduced, mod)) {
-                    stim += bound_mod_to_vals(stim, val, it.get_max_val("STIM", reduced),
-                                                it.get_min_val("STIM", reduced));
-                }
+        // Handle stim
+        val = it.get_mod("STIM", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "STIM", val, reduced, mod)) {
+                stim += bound_mod_to_vals(stim, val, it.get_max_val("STIM", reduced),
+                                            it.get_min_val("STIM", reduced));
             }
+        }
 
-            // Handle hunger
-            val = it.get_mod("HUNGER", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "HUNGER", val, reduced, mod)) {
-                    hunger += bound_mod_to_vals(hunger, val, it.get_max_val("HUNGER", reduced),
-                                                it.get_min_val("HUNGER", reduced));
-                }
+        // Handle hunger
+        val = it.get_mod("HUNGER", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "HUNGER", val, reduced, mod)) {
+                hunger += bound_mod_to_vals(hunger, val, it.get_max_val("HUNGER", reduced),
+                                            it.get_min_val("HUNGER", reduced));
             }
+        }
 
-            // Handle thirst
-            val = it.get_mod("THIRST", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "THIRST", val, reduced, mod)) {
-                    thirst += bound_mod_to_vals(thirst, val, it.get_max_val("THIRST", reduced),
-                                                it.get_min_val("THIRST", reduced));
-                }
+        // Handle thirst
+        val = it.get_mod("THIRST", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "THIRST", val, reduced, mod)) {
+                thirst += bound_mod_to_vals(thirst, val, it.get_max_val("THIRST", reduced),
+                                            it.get_min_val("THIRST", reduced));
             }
+        }
 
-            // Handle fatigue
-            val = it.get_mod("FATIGUE", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "FATIGUE", val, reduced, mod)) {
-                    fatigue += bound_mod_to_vals(fatigue, val, it.get_max_val("FATIGUE", reduced),
-                                                it.get_min_val("FATIGUE", reduced));
-                }
+        // Handle fatigue
+        val = it.get_mod("FATIGUE", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "FATIGUE", val, reduced, mod)) {
+                fatigue += bound_mod_to_vals(fatigue, val, it.get_max_val("FATIGUE", reduced),
+                                            it.get_min_val("FATIGUE", reduced));
             }
+        }
 
-            // Handle Radiation
-            val = it.get_mod("RAD", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "RAD", val, reduced, mod)) {
-                    radiation += bound_mod_to_vals(radiation, val, it.get_max_val("RAD", reduced), 0);
-                    // Radiation can't go negative
-                    if (radiation < 0) {
-                        radiation = 0;
-                    }
+        // Handle Radiation
+        val = it.get_mod("RAD", reduced);
+        if (val != 0) {
+            mod = 1;
+            if(it.activated(calendar::turn, "RAD", val, reduced, mod)) {
+                radiation += bound_mod_to_vals(radiation, val, it.get_max_val("RAD", reduced), 0);
+                // Radiation can't go negative
+                if (radiation < 0) {
+                    radiation = 0;
                 }
             }
+        }
 
-            // Handle stat changes
-            mod_str_bonus(it.get_mod("STR", reduced));
-            mod_dex_bonus(it.get_mod("DEX", reduced));
-            mod_per_bonus(it.get_mod("PER", reduced));
-            mod_int_bonus(it.get_mod("INT", reduced));
-            // Speed is already added in recalc_speed_bonus
+        // Handle stat changes
+        mod_str_bonus(it.get_mod("STR", reduced));
+        mod_dex_bonus(it.get_mod("DEX", reduced));
+        mod_per_bonus(it.get_mod("PER", reduced));
+        mod_int_bonus(it.get_mod("INT", reduced));
+        // Speed is already added in recalc_speed_bonus
 
-            // Handle Pain
-            val = it.get_mod("PAIN", reduced);
-            if (val != 0) {
-                mod = 1;
-                if (it.get_sizing("PAIN")) {
-                    if (has_trait("FAT")) {
-                        mod *= 1.5;
-                    }
-                    if (has_trait("LARGE") || has_trait("LARGE_OK")) {
-                        mod *= 2;
-                    }
-                    if (has_trait("HUGE") || has_trait("HUGE_OK")) {
-                        mod *= 3;
-                    }
+        // Handle Pain
+        val = it.get_mod("PAIN", reduced);
+        if (val != 0) {
+            mod = 1;
+            if (it.get_sizing("PAIN")) {
+                if (has_trait("FAT")) {
+                    mod *= 1.5;
                 }
-                if(it.activated(calendar::turn, "PAIN", val, reduced, mod)) {
-                    int pain_inc = bound_mod_to_vals(pain, val, it.get_max_val("PAIN", reduced), 0);
-                    mod_pain(pain_inc);
-                    if (pain_inc > 0) {
-                        add_pain_msg(val, bp);
-                    }
+                if (has_trait("LARGE") || has_trait("LARGE_OK")) {
+                    mod *= 2;
                 }
-            }
-
-            // Handle Damage
-            val = it.get_mod("HURT", reduced);
-            if (val != 0) {
-                mod = 1;
-                if (it.get_sizing("HURT")) {
-                    if (has_trait("FAT")) {
-                        mod *= 1.5;
-                    }
-                    if (has_trait("LARGE") || has_trait("LARGE_OK")) {
-                        mod *= 2;
-                    }
-                    if (has_trait("HUGE") || has_trait("HUGE_OK")) {
-                        mod *= 3;
-                    }
+                if (has_trait("HUGE") || has_trait("HUGE_OK")) {
+                    mod *= 3;
                 }
-                if(it.activated(calendar::turn, "HURT", val, reduced, mod)) {
-                    if (bp == num_bp) {
-                        if (val > 5) {
-                            add_msg_if_player(_("Your %s HURTS!"), body_part_name_accusative(bp_torso).c_str());
-                        } else {
-                            add_msg_if_player(_("Your %s hurts!"), body_part_name_accusative(bp_torso).c_str());
-                        }
-                        apply_damage(nullptr, bp_torso, val);
-                    } else {
-                        if (val > 5) {
-                            add_msg_if_player(_("Your %s HURTS!"), body_part_name_accusative(bp).c_str());
-                        } else {
-                            add_msg_if_player(_("Your %s hurts!"), body_part_name_accusative(bp).c_str());
-                        }
-                        apply_damage(nullptr, bp, val);
-                    }
+            }
+            if(it.activated(calendar::turn, "PAIN", val, reduced, mod)) {
+                int pain_inc = bound_mod_to_vals(pain, val, it.get_max_val("PAIN", reduced), 0);
+                mod_pain(pain_inc);
+                if (pain_inc > 0) {
+                    add_pain_msg(val, bp);
                 }
             }
+        }
 
-            // Handle Sleep
-            val = it.get_mod("SLEEP", reduced);
-            if (val != 0) {
-                mod = 1;
-                if(it.activated(calendar::turn, "SLEEP", val, reduced, mod)) {
-                    add_msg_if_player(_("You pass out!"));
-                    fall_asleep(val);
+        // Handle Damage
+        val = it.get_mod("HURT", reduced);
+        if (val != 0) {
+            mod = 1;
+            if (it.get_sizing("HURT")) {
+                if (has_trait("FAT")) {
+                    mod *= 1.5;
+                }
+                if (has_trait("LARGE") || has_trait("LARGE_OK")) {
+                    mod *= 2;
+                }
+                if (has_trait("HUGE") || has_trait("HUGE_OK")) {
+                    mod *= 3;
                 }
             }
-
-            // Handle painkillers
-            val = it.get_mod("PKILL", reduced);
-            if (val != 0) {
-                mod = it.get_addict_mod("PKILL", addiction_level(ADD_PKILLER));
-                if(it.activated(calendar::turn, "PKILL", val, reduced, mod)) {
-                    pkill += bound_mod_to_vals(pkill, val, it.get_max_val("PKILL", reduced), 0);
+            if(it.activated(calendar::turn, "HURT", val, reduced, mod)) {
+                if (bp == num_bp) {
+                    if (val > 5) {
+                        add_msg_if_player(_("Your %s HURTS!"), body_part_name_accusative(bp_torso).c_str());
+                    } else {
+                        add_msg_if_player(_("Your %s hurts!"), body_part_name_accusative(bp_torso).c_str());
+                    }
+                    apply_damage(nullptr, bp_torso, val);
+                } else {
+                    if (val > 5) {
+                        add_msg_if_player(_("Your %s HURTS!"), body_part_name_accusative(bp).c_str());
+                    } else {
+                        add_msg_if_player(_("Your %s hurts!"), body_part_name_accusative(bp).c_str());
+                    }
+                    apply_damage(nullptr, bp, val);
                 }
             }
+        }
 
-            // Handle coughing
+        // Handle Sleep
+        val = it.get_mod("SLEEP", reduced);
+        if (val != 0) {
             mod = 1;
-            val = 0;
-            if (it.activated(calendar::turn, "COUGH", val, reduced, mod)) {
-                cough(it.get_harmful_cough());
+            if(it.activated(calendar::turn, "SLEEP", val, reduced, mod)) {
+                add_msg_if_player(_("You pass out!"));
+                fall_asleep(val);
             }
+        }
 
-            // Handle vomiting
-            mod = vomit_mod();
-            val = 0;
-            if (it.activated(calendar::turn, "VOMIT", val, reduced, mod)) {
-                vomit();
+        // Handle painkillers
+        val = it.get_mod("PKILL", reduced);
+        if (val != 0) {
+            mod = it.get_addict_mod("PKILL", addiction_level(ADD_PKILLER));
+            if(it.activated(calendar::turn, "PKILL", val, reduced, mod)) {
+                pkill += bound_mod_to_vals(pkill, val, it.get_max_val("PKILL", reduced), 0);
             }
         }
+
+        // Handle coughing
+        mod = 1;
+        val = 0;
+        if (it.activated(calendar::turn, "COUGH", val, reduced, mod)) {
+            cough(it.get_harmful_cough());
+        }
+
+        // Handle vomiting
+        mod = vomit_mod();
+        val = 0;
+        if (it.activated(calendar::turn, "VOMIT", val, reduced, mod)) {
+            vomit();
+        }
     }
 
     Creature::process_effects();
@@ -6034,7 +6027,7 @@ void player::hardcoded_effects(effect &it)
     int dur = it.get_duration();
     int intense = it.get_intensity();
     body_part bp = it.get_bp();
-    bool sleeping = has_effect("sleep");
+    bool sleeping = has_effect(effect_sleep);
     bool msg_trig = one_in(400);
     if (id == "onfire") {
         // TODO: this should be determined by material properties
@@ -7324,7 +7317,7 @@ void player::hardcoded_effects(effect &it)
             }
         }
     } else if (id == "alarm_clock") {
-        if (has_effect("sleep")) {
+        if (has_effect(effect_sleep)) {
             if (dur == 1) {
                 if(has_bionic("bio_watch")) {
                     // Normal alarm is volume 12, tested against (2/3/6)d15 for
@@ -7698,7 +7691,7 @@ void player::suffer()
             auto_use = false;
         }
 
-        if (has_effect("sleep")) {
+        if (has_effect(effect_sleep)) {
             add_msg_if_player(_("You have an asthma attack!"));
             wake_up();
             auto_use = false;
@@ -8129,7 +8122,7 @@ void player::mend()
             }
 
             // Bed rest speeds up mending
-            if(has_effect("sleep")) {
+            if(has_effect(effect_sleep)) {
                 healing_factor *= 4.0;
             } else if(fatigue > 383) {
             // but being dead tired does not...
@@ -8232,13 +8225,11 @@ void player::vomit()
     thirst += quench_loss;
     moves -= 100;
     for( auto &elem : effects ) {
-        for( auto &_effect_it : elem.second ) {
-            auto &it = _effect_it.second;
-            if (it.get_id() == "foodpoison") {
-                it.mod_duration(-300);
-            } else if (it.get_id() == "drunk" ) {
-                it.mod_duration(rng(-100, -500));
-            }
+        auto &it = elem.second;
+        if (it.get_id() == "foodpoison") {
+            it.mod_duration(-300);
+        } else if (it.get_id() == "drunk" ) {
+            it.mod_duration(rng(-100, -500));
         }
     }
     remove_effect("pkill1");
@@ -13483,6 +13474,16 @@ bool player::sees( const Creature &critter, int &bresen1, int &bresen2 ) const
     return Creature::sees( critter, bresen1, bresen2 );
 }
 
+int player::max_sight_distance() const
+{
+    if( has_active_bionic( "bio_ground_sonar" ) ) {
+        // Sees digging creatures at any distance.
+        return MAPSIZE * SEEX;
+    }
+    // 3 for ANTENNAE, see sees( const Creature & ).
+    return std::max( { Creature::max_sight_distance(), 3, clairvoyance() } );
+}
+
 bool player::can_pickup(bool print_msg) const
 {
     if (weapon.has_flag("NO_PICKUP")) {
@@ -284,6 +284,7 @@ class player : public Character, public JsonSerializer, public JsonDeserializer
         const tripoint &pos() const override;
         /** Returns the player's sight range */
         int sight_range( int light_level ) const override;
+        int max_sight_distance() const override;
         /** Returns the player maximum vision range factoring in mutations, diseases, and other effects */
         int  unimpaired_range();
         /** Returns true if overmap tile is within player line-of-sight */
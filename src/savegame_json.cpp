@@ -982,6 +982,7 @@ void inventory::json_save_items(JsonOut &json) const
 
 void inventory::json_load_items(JsonIn &jsin)
 {
+    bulk_add adding( *this );
     try {
         JsonArray ja = jsin.get_array();
         while ( ja.has_more() ) {
@@ -1741,12 +1742,10 @@ void Creature::store( JsonOut &jsout ) const
 
     // Because JSON requires string keys we need to convert our int keys
     std::unordered_map<std::string, std::unordered_map<std::string, effect>> tmp_map;
-    for (auto maps : effects) {
-        for (auto i : maps.second) {
-            std::ostringstream convert;
-            convert << i.first;
-            tmp_map[maps.first][convert.str()] = i.second;
-        }
+    for( auto &elem : effects ) {
+        std::ostringstream convert;
+        convert << elem.second.get_bp();
+        tmp_map[elem.second.get_id()][convert.str()] = elem.second;
     }
     jsout.member( "effects", tmp_map );
 
@@ -1813,11 +1812,16 @@ void Creature::load( JsonObject &jsin )
             jsin.read( "effects", tmp_map );
             int key_num;
             for (auto maps : tmp_map) {
+                const auto type = effect_types.find( maps.first );
+                if( type == effect_types.end() ) {
+                    debugmsg( "creature has invalid effect %s, it will be ignored", maps.first.c_str() );
+                    continue;
+                }
                 for (auto i : maps.second) {
                     if ( !(std::istringstream(i.first) >> key_num) ) {
                         key_num = 0;
                     }
-                    effects[maps.first][(body_part)key_num] = i.second;
+                    effects[std::make_pair( type->second.loadid, (body_part)key_num )] = i.second;
                 }
             }
         }
@@ -8,7 +8,9 @@
 #include "cursesdef.h"
 #include "debug.h"
 #include <cstring>
+#include <cstdio>
 #include <vector>
+#include <unordered_map>
 #include <fstream>
 #include <sstream>
 #include <sys/stat.h>
@@ -105,27 +107,45 @@ public:
     void load_font(std::string typeface, int fontsize);
     virtual void OutputChar(std::string ch, int x, int y, unsigned char color);
 protected:
-    SDL_Texture *create_glyph(const std::string &ch, int color);
+    SDL_Surface *create_glyph(const std::string &ch, int color);
 
     TTF_Font* font;
-    // Maps (character code, color) to SDL_Texture*
+    // Maps (character code, color) to the glyph on one of the glyph pages
 
     struct key_t {
         std::string   codepoints;
         unsigned char color;
 
-        bool operator<(key_t const &rhs) const noexcept {
-            return (color == rhs.color) ? codepoints < rhs.codepoints : color < rhs.color;
+        bool operator==(key_t const &rhs) const noexcept {
+            return color == rhs.color && codepoints == rhs.codepoints;
         }
     };
-    
+
+    struct key_hash {
+        size_t operator()(key_t const &key) const {
+            return std::hash<std::string>()(key.codepoints) * 16 + key.color;
+        }
+    };
+
     struct cached_t {
+        // The page containing the glyph, NULL if the glyph could not be created
         SDL_Texture* texture;
-        int          width;
+        SDL_Rect     rect;
     };
 
-    typedef std::map<key_t, cached_t> t_glyph_map;
+    typedef std::unordered_map<key_t, cached_t, key_hash> t_glyph_map;
     t_glyph_map glyph_cache_map;
+
+    /**
+     * Glyphs are rendered into a few large textures (pages) instead of one
+     * texture each, so drawing text rarely switches textures and the renderer
+     * can batch the copies. New glyphs are appended to the last page, row by row.
+     */
+    bool add_to_page(SDL_Surface *glyph, cached_t &value);
+    std::vector<SDL_Texture *> glyph_pages;
+    // Position of the next glyph on the last page
+    int page_x;
+    int page_y;
 };
 
 /**
@@ -449,26 +469,19 @@ inline void FillRectDIB(int x, int y, int width, int height, unsigned char color
 }
 
 
-SDL_Texture *CachedTTFFont::create_glyph(const std::string &ch, int color)
+SDL_Surface *CachedTTFFont::create_glyph(const std::string &ch, int color)
 {
     SDL_Surface * sglyph = (fontblending ? TTF_RenderUTF8_Blended : TTF_RenderUTF8_Solid)(font, ch.c_str(), windowsPalette[color]);
     if (sglyph == NULL) {
         dbg( D_ERROR ) << "Failed to create glyph for " << ch << ": " << TTF_GetError();
         return NULL;
     }
-    /* SDL interprets each pixel as a 32-bit number, so our masks must depend
-       on the endianness (byte order) of the machine */
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-    static const Uint32 rmask = 0xff000000;
-    static const Uint32 gmask = 0x00ff0000;
-    static const Uint32 bmask = 0x0000ff00;
-    static const Uint32 amask = 0x000000ff;
-#else
-    static const Uint32 rmask = 0x000000ff;
+    // The layout of SDL_PIXELFORMAT_ARGB8888, the format of the glyph pages.
+    // SDL interprets each pixel as a 32-bit number, so it does not depend on the byte order.
+    static const Uint32 rmask = 0x00ff0000;
     static const Uint32 gmask = 0x0000ff00;
-    static const Uint32 bmask = 0x00ff0000;
+    static const Uint32 bmask = 0x000000ff;
     static const Uint32 amask = 0xff000000;
-#endif
     const int wf = utf8_wrapper( ch ).display_width();
     // Note: bits per pixel must be 8 to be synchron with the surface
     // that TTF_RenderGlyph above returns. This is important for SDL_BlitScaled
@@ -476,9 +489,8 @@ SDL_Texture *CachedTTFFont::create_glyph(const std::string &ch, int color)
                                                 rmask, gmask, bmask, amask);
     if (surface == NULL) {
         dbg( D_ERROR ) << "CreateRGBSurface failed: " << SDL_GetError();
-        SDL_Texture *glyph = SDL_CreateTextureFromSurface(renderer, sglyph);
         SDL_FreeSurface(sglyph);
-        return glyph;
+        return NULL;
     }
     SDL_Rect src_rect = { 0, 0, sglyph->w, sglyph->h };
     SDL_Rect dst_rect = { 0, 0, fontwidth * wf, fontheight };
@@ -500,36 +512,74 @@ SDL_Texture *CachedTTFFont::create_glyph(const std::string &ch, int color)
     if (SDL_BlitSurface(sglyph, &src_rect, surface, &dst_rect) != 0) {
         dbg( D_ERROR ) << "SDL_BlitSurface failed: " << SDL_GetError();
         SDL_FreeSurface(surface);
-    } else {
-        SDL_FreeSurface(sglyph);
-        sglyph = surface;
+        surface = NULL;
     }
-
-    SDL_Texture *glyph = SDL_CreateTextureFromSurface(renderer, sglyph);
     SDL_FreeSurface(sglyph);
-    return glyph;
+    return surface;
 }
 
-void CachedTTFFont::OutputChar(std::string ch, int const x, int const y, unsigned char const color)
-{   
-    key_t    key {std::move(ch), static_cast<unsigned char>(color & 0xf)};
-    cached_t value;
+// Size of the glyph pages, small enough for the texture size limit of any renderer
+static const int GLYPH_PAGE_SIZE = 1024;
 
-    auto const it = glyph_cache_map.lower_bound(key);
-    if (it != std::end(glyph_cache_map) && !glyph_cache_map.key_comp()(key, it->first)) {
-        value = it->second;
-    } else {
-        value.texture = create_glyph(key.codepoints, key.color);
-        value.width = fontwidth * utf8_wrapper(key.codepoints).display_width();
-        glyph_cache_map.insert(it, std::make_pair(std::move(key), value));
+bool CachedTTFFont::add_to_page(SDL_Surface *glyph, cached_t &value)
+{
+    if (glyph->w > GLYPH_PAGE_SIZE || glyph->h > GLYPH_PAGE_SIZE) {
+        dbg( D_ERROR ) << "Glyph of " << glyph->w << "x" << glyph->h << " does not fit on a glyph page";
+        return false;
+    }
+    if (page_x + glyph->w > GLYPH_PAGE_SIZE) {
+        page_x = 0;
+        page_y += fontheight;
+    }
+    if (glyph_pages.empty() || page_y + glyph->h > GLYPH_PAGE_SIZE) {
+        SDL_Texture *page = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                              SDL_TEXTUREACCESS_STATIC, GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE);
+        if (page == NULL) {
+            dbg( D_ERROR ) << "SDL_CreateTexture failed: " << SDL_GetError();
+            return false;
+        }
+        if (SDL_SetTextureBlendMode(page, SDL_BLENDMODE_BLEND) != 0) {
+            dbg( D_ERROR ) << "SDL_SetTextureBlendMode failed: " << SDL_GetError();
+        }
+        glyph_pages.push_back(page);
+        page_x = 0;
+        page_y = 0;
+    }
+    value.texture = glyph_pages.back();
+    value.rect = { page_x, page_y, glyph->w, glyph->h };
+    if (SDL_UpdateTexture(value.texture, &value.rect, glyph->pixels, glyph->pitch) != 0) {
+        dbg( D_ERROR ) << "SDL_UpdateTexture failed: " << SDL_GetError();
+        return false;
+    }
+    page_x += glyph->w;
+    return true;
+}
+
+void CachedTTFFont::OutputChar(std::string ch, int const x, int const y, unsigned char const color)
+{
+    key_t key {std::move(ch), static_cast<unsigned char>(color & 0xf)};
+
+    auto it = glyph_cache_map.find(key);
+    if (it == std::end(glyph_cache_map)) {
+        cached_t value;
+        value.texture = NULL;
+        SDL_Surface *glyph = create_glyph(key.codepoints, key.color);
+        if (glyph != NULL) {
+            if (!add_to_page(glyph, value)) {
+                value.texture = NULL;
+            }
+            SDL_FreeSurface(glyph);
+        }
+        it = glyph_cache_map.insert(std::make_pair(std::move(key), value)).first;
     }
+    const cached_t &value = it->second;
 
     if (!value.texture) {
         // Nothing we can do here )-:
         return;
     }
-    SDL_Rect rect {x, y, value.width, fontheight};
-    if (SDL_RenderCopy( renderer, value.texture, nullptr, &rect)) {
+    SDL_Rect rect {x, y, value.rect.w, fontheight};
+    if (SDL_RenderCopy( renderer, value.texture, &value.rect, &rect)) {
         dbg(D_ERROR) << "SDL_RenderCopy failed: " << SDL_GetError();
     }
 }
@@ -560,29 +610,61 @@ void BitmapFont::OutputChar(long t, int x, int y, unsigned char color)
 }
 
 #ifdef SDLTILES
+static void present_display_buffer()
+{
+    // Select default target (the window), copy rendered buffer
+    // there, present it, select the buffer as target again.
+    if( SDL_SetRenderTarget( renderer, NULL ) != 0 ) {
+        dbg(D_ERROR) << "SDL_SetRenderTarget failed: " << SDL_GetError();
+    }
+    if( SDL_RenderCopy( renderer, display_buffer, NULL, NULL ) != 0 ) {
+        dbg(D_ERROR) << "SDL_RenderCopy failed: " << SDL_GetError();
+    }
+    SDL_RenderPresent(renderer);
+    if( SDL_SetRenderTarget( renderer, display_buffer ) != 0 ) {
+        dbg(D_ERROR) << "SDL_SetRenderTarget failed: " << SDL_GetError();
+    }
+}
+
 // only update if the set interval has elapsed
 void try_update()
 {
     unsigned long now = SDL_GetTicks();
     if (now - lastupdate >= interval) {
-        // Select default target (the window), copy rendered buffer
-        // there, present it, select the buffer as target again.
-        if( SDL_SetRenderTarget( renderer, NULL ) != 0 ) {
-            dbg(D_ERROR) << "SDL_SetRenderTarget failed: " << SDL_GetError();
-        }
-        if( SDL_RenderCopy( renderer, display_buffer, NULL, NULL ) != 0 ) {
-            dbg(D_ERROR) << "SDL_RenderCopy failed: " << SDL_GetError();
-        }
-        SDL_RenderPresent(renderer);
-        if( SDL_SetRenderTarget( renderer, display_buffer ) != 0 ) {
-            dbg(D_ERROR) << "SDL_SetRenderTarget failed: " << SDL_GetError();
-        }
+        present_display_buffer();
         needupdate = false;
         lastupdate = now;
     } else {
         needupdate = true;
     }
 }
+
+/**
+ * Fills the whole terminal with random characters in random colors, frame after frame,
+ * and prints how fast that was. Measures the text rendering (the font and the renderer).
+ */
+void benchmark_text_rendering(int frames)
+{
+    static const std::string glyphs =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,;:!?#@%&*+-=/|<>()[]{}~^";
+    const Uint32 start = SDL_GetTicks();
+    for( int frame = 0; frame < frames; frame++ ) {
+        for( int y = 0; y < TERMINAL_HEIGHT; y++ ) {
+            for( int x = 0; x < TERMINAL_WIDTH; x++ ) {
+                const int drawx = x * fontwidth;
+                const int drawy = y * fontheight;
+                FillRectDIB( drawx, drawy, fontwidth, fontheight, std::rand() % 16 );
+                font->OutputChar( std::string( 1, glyphs[std::rand() % glyphs.size()] ), drawx, drawy,
+                                  std::rand() % 16 );
+            }
+        }
+        present_display_buffer();
+    }
+    const double seconds = std::max<Uint32>( SDL_GetTicks() - start, 1 ) / 1000.0;
+    printf( "Drew %d frames of %dx%d cells in %.3f seconds: %.1f frames, %.0f cells per second.\n",
+            frames, TERMINAL_WIDTH, TERMINAL_HEIGHT, seconds, frames / seconds,
+            frames * TERMINAL_WIDTH * TERMINAL_HEIGHT / seconds );
+}
 #endif
 
 // line_id is one of the LINE_*_C constants
@@ -734,18 +816,60 @@ bool Font::draw_window( WINDOW *win, int offsetx, int offsety )
             fontScaleBuffer = tilecontext->get_tile_width();
     }
     const int fontScale = tilecontext->get_tile_width();
+    //This creates a problem when map_font is different from the regular font
+    //Specifically when showing the overmap
+    //And in some instances of screen change, i.e. inventory.
+    bool oldWinCompatible = false;
+    /*
+    Let's try to keep track of different windows.
+    A number of windows are coexisting on the screen, so don't have to interfere.
+
+    g->w_terrain, g->w_minimap, g->w_HP, g->w_status, g->w_status2, g->w_messages,
+     g->w_location, and g->w_minimap, can be buffered if either of them was
+     the previous window.
+
+    g->w_overmap and g->w_omlegend are likewise.
+
+    Everything else works on strict equality because there aren't yet IDs for some of them.
+    */
+    if ( win == g->w_terrain || win == g->w_minimap || win == g->w_HP || win == g->w_status ||
+         win == g->w_status2 || win == g->w_messages || win == g->w_location ) {
+        if ( winBuffer == g->w_terrain || winBuffer == g->w_minimap ||
+             winBuffer == g->w_HP || winBuffer == g->w_status || winBuffer == g->w_status2 ||
+             winBuffer == g->w_messages || winBuffer == g->w_location ) {
+            oldWinCompatible = true;
+        }
+    }else if ( win == g->w_overmap || win == g->w_omlegend ){
+        if ( winBuffer == g->w_overmap || winBuffer == g->w_omlegend ) {
+            oldWinCompatible = true;
+        }
+    }else {
+        if( win == winBuffer ) {
+            oldWinCompatible = true;
+        }
+    }
+    const bool use_framebuffer = oldWinCompatible && fontScale == fontScaleBuffer;
+
     bool update = false;
+    // Changed cells of the current line, their characters are drawn after the
+    // background of the whole line has been filled.
+    static std::vector<int> changed_cells;
     for( int j = 0; j < win->height; j++ ) {
         if( !win->line[j].touched ) {
             continue;
         }
         update = true;
         win->line[j].touched = false;
+        changed_cells.clear();
+        const int drawy = offsety + j * fontheight;
+        // Adjacent changed cells with the same background color are filled at once
+        int run_x = 0;
+        int run_width = 0;
+        int run_color = 0;
         for( int i = 0; i < win->width; i++ ) {
             const cursecell &cell = win->line[j].chars[i];
 
             const int drawx = offsetx + i * fontwidth;
-            const int drawy = offsety + j * fontheight;
             if( drawx + fontwidth > WindowWidth || drawy + fontheight > WindowHeight ) {
                 // Outside of the display area, would not render anyway
                 continue;
@@ -756,40 +880,7 @@ bool Font::draw_window( WINDOW *win, int offsetx, int offsety )
             const int fbx = win->x + i;
             const int fby = win->y + j;
             cursecell &oldcell = framebuffer[fby].chars[fbx];
-            //This creates a problem when map_font is different from the regular font
-            //Specifically when showing the overmap
-            //And in some instances of screen change, i.e. inventory.
-            bool oldWinCompatible = false;
-            /*
-            Let's try to keep track of different windows.
-            A number of windows are coexisting on the screen, so don't have to interfere.
-
-            g->w_terrain, g->w_minimap, g->w_HP, g->w_status, g->w_status2, g->w_messages,
-             g->w_location, and g->w_minimap, can be buffered if either of them was
-             the previous window.
-
-            g->w_overmap and g->w_omlegend are likewise.
-
-            Everything else works on strict equality because there aren't yet IDs for some of them.
-            */
-            if ( win == g->w_terrain || win == g->w_minimap || win == g->w_HP || win == g->w_status ||
-                 win == g->w_status2 || win == g->w_messages || win == g->w_location ) {
-                if ( winBuffer == g->w_terrain || winBuffer == g->w_minimap ||
-                     winBuffer == g->w_HP || winBuffer == g->w_status || winBuffer == g->w_status2 ||
-                     winBuffer == g->w_messages || winBuffer == g->w_location ) {
-                    oldWinCompatible = true;
-                }
-            }else if ( win == g->w_overmap || win == g->w_omlegend ){
-                if ( winBuffer == g->w_overmap || winBuffer == g->w_omlegend ) {
-                    oldWinCompatible = true;
-                }
-            }else {
-                if( win == winBuffer ) {
-                    oldWinCompatible = true;
-                }
-            }
-
-            if (cell == oldcell && oldWinCompatible && fontScale == fontScaleBuffer) {
+            if( use_framebuffer && cell == oldcell ) {
                 continue;
             }
             oldcell = cell;
@@ -797,24 +888,43 @@ bool Font::draw_window( WINDOW *win, int offsetx, int offsety )
             if( cell.ch.empty() ) {
                 continue; // second cell of a multi-cell character
             }
+            int cw = 1;
             const char *utf8str = cell.ch.c_str();
             int len = cell.ch.length();
-            const int codepoint = UTF8_getch( &utf8str, &len );
-            const int FG = cell.FG;
-            const int BG = cell.BG;
-            if( codepoint != UNKNOWN_UNICODE ) {
-                const int cw = utf8_width( cell.ch.c_str() );
+            if( UTF8_getch( &utf8str, &len ) != UNKNOWN_UNICODE ) {
+                cw = utf8_width( cell.ch.c_str() );
                 if( cw < 1 ) {
                     // utf8_width() may return a negative width
                     continue;
                 }
-                FillRectDIB( drawx, drawy, fontwidth * cw, fontheight, BG );
+            }
+            if( run_width > 0 && ( run_x + run_width != drawx || run_color != cell.BG ) ) {
+                FillRectDIB( run_x, drawy, run_width, fontheight, run_color );
+                run_width = 0;
+            }
+            if( run_width == 0 ) {
+                run_x = drawx;
+                run_color = cell.BG;
+            }
+            run_width += fontwidth * cw;
+            changed_cells.push_back( i );
+        }
+        if( run_width > 0 ) {
+            FillRectDIB( run_x, drawy, run_width, fontheight, run_color );
+        }
+
+        for( const int i : changed_cells ) {
+            const cursecell &cell = win->line[j].chars[i];
+            const int drawx = offsetx + i * fontwidth;
+            const char *utf8str = cell.ch.c_str();
+            int len = cell.ch.length();
+            const int codepoint = UTF8_getch( &utf8str, &len );
+            const int FG = cell.FG;
+            if( codepoint != UNKNOWN_UNICODE ) {
                 OutputChar( cell.ch, drawx, drawy, FG );
             } else {
-                FillRectDIB( drawx, drawy, fontwidth, fontheight, BG );
                 draw_ascii_lines( static_cast<unsigned char>( cell.ch[0] ), drawx, drawy, FG );
             }
-
         }
     }
     win->draw = false; //We drew the window, mark it as so
@@ -1844,6 +1954,8 @@ void BitmapFont::draw_ascii_lines(unsigned char line_id, int drawx, int drawy, i
 CachedTTFFont::CachedTTFFont(int w, int h)
 : Font(w, h)
 , font(NULL)
+, page_x(0)
+, page_y(0)
 {
 }
 
@@ -1858,11 +1970,12 @@ void CachedTTFFont::clear()
         TTF_CloseFont(font);
         font = NULL;
     }
-    for (t_glyph_map::iterator a = glyph_cache_map.begin(); a != glyph_cache_map.end(); ++a) {
-        if (a->second.texture) {
-            SDL_DestroyTexture(a->second.texture);
-        }
+    for (auto &page : glyph_pages) {
+        SDL_DestroyTexture(page);
     }
+    glyph_pages.clear();
+    page_x = 0;
+    page_y = 0;
     glyph_cache_map.clear();
 }
 
@@ -10,6 +10,8 @@
 #include "monster.h"
 #include "line.h"
 
+#include <utility>
+
 struct sound_event {
     int volume;
     std::string description;
@@ -71,6 +73,7 @@ static void vector_quick_remove( std::vector<C> &source, int index )
     source.pop_back();
 }
 
+// Takes the sounds by value, as the seeds of the clusters are removed from it.
 static std::vector<centroid> cluster_sounds( std::vector<std::pair<tripoint, int>> recent_sounds )
 {
     // If there are too many monsters and too many noise sources (which can be monsters, go figure),
@@ -126,7 +129,8 @@ static std::vector<centroid> cluster_sounds( std::vector<std::pair<tripoint, int
 
 void sounds::process_sounds()
 {
-    std::vector<centroid> sound_clusters = cluster_sounds( recent_sounds );
+    // recent_sounds is cleared at the end anyway, no need to copy it.
+    std::vector<centroid> sound_clusters = cluster_sounds( std::move( recent_sounds ) );
 
     const int weather_vol = weather_data(g->weather).sound_attn;
     for( const auto &this_centroid : sound_clusters ) {
@@ -144,8 +148,12 @@ void sounds::process_sounds()
             const tripoint target( abs_sm.x, abs_sm.y, source.z );
             overmap_buffer.signal_hordes( target, sig_power );
         }
+        if( vol <= 0 ) {
+            continue;
+        }
         // Alert all monsters (that can hear) to the sound.
-        for (int i = 0, numz = g->num_zombies(); i < numz; i++) {
+        // Even monsters with good hearing only hear it if they are closer than twice the volume.
+        for( const int i : g->mons_in_range( source, vol * 2 - 1 ) ) {
             monster &critter = g->zombie(i);
             // rl_dist() is faster than critter.has_flag() or critter.can_hear(), so we'll check it first.
             int dist = rl_dist( source, critter.pos3() );
@@ -113,6 +113,15 @@ class string_id {
         bool is_valid() const;
     private:
         std::string _id;
+        /**
+         * Types that have an int_id can cache the result of @ref id() here. The cached value is
+         * only valid if @ref _version matches the version of the registry the id was resolved in,
+         * which the registry changes whenever previously resolved ids may become wrong (e.g. when
+         * the data is unloaded).
+         * Copies of the id share the cache, the string is never changed after construction.
+         */
+        mutable int _cid = -1;
+        mutable int _version = -1;
 };
 
 // Support hashing of string based ids by forwarding the hash of the string.
@@ -7,6 +7,8 @@
 
 std::vector< trap* > traplist;
 std::unordered_map< trap_str_id, trap_id > trapmap;
+// Changed when trap ids may refer to different traps, see string_id::_version.
+static int trapmap_version = 0;
 
 template<>
 const trap &int_id<trap>::obj() const
@@ -28,11 +30,16 @@ const string_id<trap> &int_id<trap>::id() const
 template<>
 int_id<trap> string_id<trap>::id() const
 {
+    if( _version == trapmap_version ) {
+        return trap_id( _cid );
+    }
     const auto iter = trapmap.find( *this );
     if( iter == trapmap.end() ) {
         debugmsg( "invalid trap id %s", c_str() );
         return trap_id();
     }
+    _cid = iter->second.to_i();
+    _version = trapmap_version;
     return iter->second;
 }
 
@@ -45,7 +52,7 @@ const trap &string_id<trap>::obj() const
 template<>
 bool string_id<trap>::is_valid() const
 {
-    return trapmap.count( *this ) > 0;
+    return _version == trapmap_version || trapmap.count( *this ) > 0;
 }
 
 template<>
@@ -98,6 +105,10 @@ void trap::load( JsonObject &jo )
     t.funnel_radius_mm = jo.get_int( "funnel_radius", 0 );
     t.trigger_weight = jo.get_int( "trigger_weight", -1 );
 
+    if( trapmap.count( t.id ) > 0 ) {
+        // Overridden by a mod, the id now refers to the new trap.
+        trapmap_version++;
+    }
     trapmap[t.id] = t.loadid;
     traplist.push_back( &t );
     trap_ptr.release();
@@ -113,6 +124,7 @@ void trap::reset()
     }
     traplist.clear();
     trapmap.clear();
+    trapmap_version++;
     funnel_traps.clear();
 }
 
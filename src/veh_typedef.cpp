@@ -73,6 +73,8 @@ std::map<vpart_str_id, vpart_info> vehicle_part_types;
 // to the matching vpart_info object. To store the object only once, it is in the map and only
 // linked to. Pointers here are always valid.
 std::vector<const vpart_info*> vehicle_part_int_types;
+// Changed when the parts are reset, invalidates the cached int ids in vpart_str_id.
+static int vehicle_part_types_version = 0;
 
 template<>
 const vpart_info &int_id<vpart_info>::obj() const
@@ -94,11 +96,16 @@ const string_id<vpart_info> &int_id<vpart_info>::id() const
 template<>
 int_id<vpart_info> string_id<vpart_info>::id() const
 {
+    if( _version == vehicle_part_types_version ) {
+        return vpart_id( _cid );
+    }
     const auto iter = vehicle_part_types.find( *this );
     if( iter == vehicle_part_types.end() ) {
         debugmsg( "invalid vehicle part id %s", c_str() );
         return vpart_id();
     }
+    _cid = iter->second.loadid.to_i();
+    _version = vehicle_part_types_version;
     return iter->second.loadid;
 }
 
@@ -111,7 +118,7 @@ const vpart_info &string_id<vpart_info>::obj() const
 template<>
 bool string_id<vpart_info>::is_valid() const
 {
-    return vehicle_part_types.count( *this ) > 0;
+    return _version == vehicle_part_types_version || vehicle_part_types.count( *this ) > 0;
 }
 
 template<>
@@ -294,6 +301,7 @@ void vpart_info::reset()
 {
     vehicle_part_types.clear();
     vehicle_part_int_types.clear();
+    vehicle_part_types_version++;
 }
 
 const std::vector<const vpart_info*> &vpart_info::get_all()
@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #include <set>
 #include <queue>
+#include <limits>
 
 /*
  * Speed up all those if ( blarg == "structure" ) statements that are used everywhere;
@@ -213,6 +214,8 @@ vehicle::vehicle(const vproto_id &type_id, int init_veh_fuel, int init_veh_statu
     face.init(0);
     move.init(0);
     of_turn_carry = 0;
+    mount_width = 0;
+    mount_height = 0;
 
     if( !type.str().empty() && type.is_valid() ) {
         const vehicle_prototype &proto = type.obj();
@@ -586,6 +589,7 @@ void vehicle::smash() {
             parts[part_index].amount = 0;
         }
     }
+    invalidate_stats();
 }
 
 void vehicle::control_doors() {
@@ -2065,7 +2069,7 @@ void vehicle::part_removal_cleanup() {
             g->m.destroy_vehicle(this);
             return;
         } else {
-            g->m.update_vehicle_cache(this, false);
+            g->m.update_vehicle_cache(this);
         }
     }
     shift_if_needed();
@@ -2109,14 +2113,21 @@ std::vector<int> vehicle::parts_at_relative (const int dx, const int dy, bool co
         }
         return res;
     } else {
-        const auto &iter = relative_parts.find( point( dx, dy ) );
-        if ( iter != relative_parts.end() ) {
-            return iter->second;
-        } else {
-            std::vector<int> res;
-            return res;
-        }
+        const part_range parts_here = parts_at_mount( point( dx, dy ) );
+        return std::vector<int>( parts_here.begin(), parts_here.end() );
+    }
+}
+
+vehicle::part_range vehicle::parts_at_mount( const point &mount ) const
+{
+    const int x = mount.x - mount_min.x;
+    const int y = mount.y - mount_min.y;
+    if( x < 0 || y < 0 || x >= mount_width || y >= mount_height ) {
+        return part_range{ nullptr, nullptr };
     }
+    const int cell = y * mount_width + x;
+    const int *const data = relative_parts.data();
+    return part_range{ data + relative_parts_offset[cell], data + relative_parts_offset[cell + 1] };
 }
 
 int vehicle::part_with_feature (int part, vpart_bitflags const flag, bool unbroken) const
@@ -2124,13 +2135,9 @@ int vehicle::part_with_feature (int part, vpart_bitflags const flag, bool unbrok
     if (part_flag(part, flag)) {
         return part;
     }
-    const auto it = relative_parts.find( parts[part].mount );
-    if ( it != relative_parts.end() ) {
-        const std::vector<int> & parts_here = it->second;
-        for (auto &i : parts_here) {
-            if (part_flag(i, flag) && (!unbroken || parts[i].hp > 0)) {
-                return i;
-            }
+    for( const int i : parts_at_mount( parts[part].mount ) ) {
+        if (part_flag(i, flag) && (!unbroken || parts[i].hp > 0)) {
+            return i;
         }
     }
     return -1;
@@ -2138,8 +2145,7 @@ int vehicle::part_with_feature (int part, vpart_bitflags const flag, bool unbrok
 
 int vehicle::part_with_feature (int part, const std::string &flag, bool unbroken) const
 {
-    std::vector<int> parts_here = parts_at_relative(parts[part].mount.x, parts[part].mount.y);
-    for( auto &elem : parts_here ) {
+    for( const int elem : parts_at_mount( parts[part].mount ) ) {
         if( part_flag( elem, flag ) && ( !unbroken || parts[elem].hp > 0 ) ) {
             return elem;
         }
@@ -2177,13 +2183,11 @@ void vehicle::set_label(int x, int y, std::string text)
 
 int vehicle::next_part_to_close(int p, bool outside)
 {
-    std::vector<int> parts_here = parts_at_relative(parts[p].mount.x, parts[p].mount.y);
+    const part_range parts_here = parts_at_mount( parts[p].mount );
 
     // We want reverse, since we close the outermost thing first (curtains), and then the innermost thing (door)
-    for(std::vector<int>::reverse_iterator part_it = parts_here.rbegin();
-        part_it != parts_here.rend();
-        ++part_it)
-    {
+    for( const int *part_it = parts_here.end(); part_it != parts_here.begin(); ) {
+        --part_it;
 
         if(part_flag(*part_it, VPFLAG_OPENABLE)
            && parts[*part_it].hp > 0  // 0 HP parts can't be opened or closed
@@ -2198,10 +2202,8 @@ int vehicle::next_part_to_close(int p, bool outside)
 
 int vehicle::next_part_to_open(int p, bool outside)
 {
-    std::vector<int> parts_here = parts_at_relative(parts[p].mount.x, parts[p].mount.y);
-
     // We want forwards, since we open the innermost thing first (curtains), and then the innermost thing (door)
-    for( auto &elem : parts_here ) {
+    for( const int elem : parts_at_mount( parts[p].mount ) ) {
         if( part_flag( elem, VPFLAG_OPENABLE ) && parts[elem].hp > 0 && parts[elem].open == 0 &&
             ( !outside || !part_flag( elem, "OPENCLOSE_INSIDE" ) ) ) {
             return elem;
@@ -2337,7 +2339,7 @@ int vehicle::part_displayed_at(int const local_x, int const local_y) const
     // it's clear where the magic number comes from.
     const int ON_ROOF_Z = 9;
 
-    std::vector<int> parts_in_square = parts_at_relative(local_x, local_y);
+    const part_range parts_in_square = parts_at_mount( point( local_x, local_y ) );
 
     if(parts_in_square.empty()) {
         return -1;
@@ -2709,6 +2711,11 @@ void vehicle::set_submap_moved( int x, int y )
 }
 
 int vehicle::total_mass() const
+{
+    return get_stats().mass;
+}
+
+int vehicle::calc_total_mass() const
 {
     int m = 0;
     for (size_t i = 0; i < parts.size(); i++)
@@ -2805,13 +2812,48 @@ int vehicle::fuel_left (const itype_id & ftype, bool recurse) const
 
 int vehicle::fuel_capacity (const itype_id &ftype) const
 {
-    int cap = 0;
-    for(auto &p : fuel) {
-        if(ftype == part_info(p).fuel_type) {
-            cap += part_info(p).size;
-        }
+    const auto &caps = get_stats().fuel_capacity;
+    const auto it = caps.find( ftype );
+    return it != caps.end() ? it->second : 0;
+}
+
+void vehicle::invalidate_stats()
+{
+    stats.valid = false;
+}
+
+const vehicle::stats_cache &vehicle::get_stats() const
+{
+    if( stats.valid ) {
+        return stats;
     }
-    return cap;
+    stats.mass = calc_total_mass();
+    stats.wheels_area = calc_wheels_area( stats.wheel_count );
+    stats.k_aerodynamics = calc_k_aerodynamics();
+    stats.fuel_capacity.clear();
+    for( auto &p : fuel ) {
+        stats.fuel_capacity[part_info( p ).fuel_type] += part_info( p ).size;
+    }
+    stats.valid = true;
+    return stats;
+}
+
+bool vehicle::stats_cache_is_current() const
+{
+    if( !stats.valid ) {
+        return true;
+    }
+    int wheel_count = 0;
+    const float area = calc_wheels_area( wheel_count );
+    if( stats.mass != calc_total_mass() || stats.wheels_area != area ||
+        stats.wheel_count != wheel_count || stats.k_aerodynamics != calc_k_aerodynamics() ) {
+        return false;
+    }
+    std::map<itype_id, int> caps;
+    for( auto &p : fuel ) {
+        caps[part_info( p ).fuel_type] += part_info( p ).size;
+    }
+    return caps == stats.fuel_capacity;
 }
 
 int vehicle::refill (const itype_id & ftype, int amount)
@@ -3051,7 +3093,7 @@ void vehicle::spew_smoke( double joules, int part )
     point p = parts[part].mount;
     int smoke = int(std::max(joules / 10000 , 1.0));
     // Move back from engine/muffler til we find an open space
-    while( relative_parts.find(p) != relative_parts.end() ) {
+    while( !parts_at_mount( p ).empty() ) {
         p.x += ( velocity < 0 ? 1 : -1 );
     }
     int rdx, rdy;
@@ -3133,6 +3175,15 @@ void vehicle::noise_and_smoke( double load, double time )
 }
 
 float vehicle::wheels_area (int *const cnt) const
+{
+    const stats_cache &st = get_stats();
+    if (cnt) {
+        *cnt = st.wheel_count;
+    }
+    return st.wheels_area;
+}
+
+float vehicle::calc_wheels_area( int &cnt ) const
 {
     int count = 0;
     int total_area = 0;
@@ -3145,9 +3196,7 @@ float vehicle::wheels_area (int *const cnt) const
         total_area += ((float)width / 9) * bigness;
         count++;
     }
-    if (cnt) {
-        *cnt = count;
-    }
+    cnt = count;
 
     if (all_parts_with_feature("FLOATS").size() > 0) {
         return 13;
@@ -3165,6 +3214,11 @@ float vehicle::k_friction() const
 }
 
 float vehicle::k_aerodynamics() const
+{
+    return get_stats().k_aerodynamics;
+}
+
+float vehicle::calc_k_aerodynamics() const
 {
     const int max_obst = 13;
     int obst[max_obst];
@@ -3916,13 +3970,34 @@ bool vehicle::collision( std::vector<veh_collision> &veh_veh_colls,
                          bool &can_move, int &imp, bool just_detect )
 {
     std::vector<int> structural_indices = all_parts_at_location(part_location_structure);
+
+    // Broad phase: bounding box of all squares the structure moves into. Parts can only
+    // hit a body if there is a monster, NPC or the player inside of it. Bodies only move
+    // as result of a body collision, so there can't be any later on if there are none now.
+    tripoint box_min( INT_MAX, INT_MAX, smz );
+    tripoint box_max( INT_MIN, INT_MIN, smz );
+    for( const int p : structural_indices ) {
+        box_min.x = std::min( box_min.x, global_x() + dx + parts[p].precalc[1].x );
+        box_min.y = std::min( box_min.y, global_y() + dy + parts[p].precalc[1].y );
+        box_max.x = std::max( box_max.x, global_x() + dx + parts[p].precalc[1].x );
+        box_max.y = std::max( box_max.y, global_y() + dy + parts[p].precalc[1].y );
+    }
+    const auto in_box = [&]( const tripoint &pos ) {
+        return pos.z == smz && pos.x >= box_min.x && pos.x <= box_max.x &&
+               pos.y >= box_min.y && pos.y <= box_max.y;
+    };
+    bool check_bodies = in_box( g->u.pos() ) || !g->mons_in_rect( box_min, box_max ).empty();
+    for( size_t i = 0; i < g->active_npc.size() && !check_bodies; i++ ) {
+        check_bodies = in_box( g->active_npc[i]->pos3() );
+    }
+
     for( size_t i = 0; i < structural_indices.size() && can_move; i++ ) {
         const int p = structural_indices[i];
         // coords of where part will go due to movement (dx/dy)
         // and turning (precalc[1])
         const int dsx = global_x() + dx + parts[p].precalc[1].x;
         const int dsy = global_y() + dy + parts[p].precalc[1].y;
-        veh_collision coll = part_collision( p, dsx, dsy, just_detect );
+        veh_collision coll = part_collision( p, dsx, dsy, just_detect, check_bodies );
         if( coll.type != veh_coll_nothing && just_detect ) {
             return true;
         } else if( coll.type == veh_coll_veh ) {
@@ -3940,13 +4015,13 @@ bool vehicle::collision( std::vector<veh_collision> &veh_veh_colls,
     return false;
 }
 
-veh_collision vehicle::part_collision( int part, int x, int y, bool just_detect )
+veh_collision vehicle::part_collision( int part, int x, int y, bool just_detect,
+                                      bool check_bodies )
 {
     const tripoint p{ x, y, smz };
-    bool pl_ctrl = player_in_control (g->u);
-    int mondex = g->mon_at( p );
-    int npcind = g->npc_at( p );
-    bool u_here = p == g->u.pos() && !g->u.in_vehicle;
+    int mondex = check_bodies ? g->mon_at( p ) : -1;
+    int npcind = check_bodies ? g->npc_at( p ) : -1;
+    bool u_here = check_bodies && p == g->u.pos() && !g->u.in_vehicle;
     monster *z = mondex >= 0? &g->zombie(mondex) : nullptr;
     player *ph = (npcind >= 0? g->active_npc[npcind] : (u_here? &g->u : 0));
 
@@ -3961,7 +4036,6 @@ veh_collision vehicle::part_collision( int part, int x, int y, bool just_detect
     bool is_body_collision = ph != nullptr || mondex >= 0;
 
     veh_coll_type collision_type = veh_coll_nothing;
-    std::string obs_name = g->m.name( p ).c_str();
 
     // vehicle collisions are a special case. just return the collision.
     // the map takes care of the dynamic stuff.
@@ -3983,7 +4057,6 @@ veh_collision vehicle::part_collision( int part, int x, int y, bool just_detect
     }
     int dmg_mod = part_info(parm).dmg_mod;
     // let's calculate type of collision & mass of object we hit
-    float mass = total_mass();
     float mass2=0;
     float e= 0.3; // e = 0 -> plastic collision
     // e = 1 -> inelastic collision
@@ -4049,6 +4122,11 @@ veh_collision vehicle::part_collision( int part, int x, int y, bool just_detect
         return ret;
     }
 
+    // Only needed once we actually hit something
+    const bool pl_ctrl = player_in_control( g->u );
+    const std::string obs_name = g->m.name( p );
+    const float mass = total_mass();
+
     int degree = rng (70, 100);
 
     //Calculate damage resulting from d_E
@@ -4438,6 +4516,7 @@ bool vehicle::add_item_at(int part, std::list<item>::iterator index, item itm)
     if( itm.needs_processing() ) {
         active_items.add( new_pos, parts[part].mount );
     }
+    invalidate_stats();
 
     return true;
 }
@@ -4475,6 +4554,7 @@ std::list<item>::iterator vehicle::remove_item( int part, std::list<item>::itera
     if( active_items.has( it, parts[part].mount ) ) {
         active_items.remove( it, parts[part].mount );
     }
+    invalidate_stats();
 
     return veh_items.erase(it);
 }
@@ -4604,7 +4684,6 @@ void vehicle::refresh()
     engines.clear();
     reactors.clear();
     solar_panels.clear();
-    relative_parts.clear();
     loose_parts.clear();
     speciality.clear();
     lights_epower = 0;
@@ -4625,7 +4704,40 @@ void vehicle::refresh()
             return veh->part_info(p1).list_order < veh->part_info(p2).list_order;
         }
     } svpv = { this };
-    std::vector<int>::iterator vii;
+
+    // Bounding box of the mount points, the part index is laid out over it
+    mount_min = point( INT_MAX, INT_MAX );
+    point mount_max( INT_MIN, INT_MIN );
+    for( const auto &part : parts ) {
+        if( !part.removed ) {
+            mount_min.x = std::min( mount_min.x, part.mount.x );
+            mount_min.y = std::min( mount_min.y, part.mount.y );
+            mount_max.x = std::max( mount_max.x, part.mount.x );
+            mount_max.y = std::max( mount_max.y, part.mount.y );
+        }
+    }
+    if( mount_max.x < mount_min.x ) {
+        mount_min = point( 0, 0 );
+        mount_width = 0;
+        mount_height = 0;
+    } else {
+        mount_width = mount_max.x - mount_min.x + 1;
+        mount_height = mount_max.y - mount_min.y + 1;
+    }
+    // Count the parts in each cell, then turn the counts into offsets
+    relative_parts_offset.assign( mount_width * mount_height + 1, 0 );
+    for( const auto &part : parts ) {
+        if( !part.removed ) {
+            const int cell = ( part.mount.y - mount_min.y ) * mount_width + ( part.mount.x - mount_min.x );
+            relative_parts_offset[cell + 1]++;
+        }
+    }
+    for( size_t i = 1; i < relative_parts_offset.size(); i++ ) {
+        relative_parts_offset[i] += relative_parts_offset[i - 1];
+    }
+    relative_parts.resize( relative_parts_offset.back() );
+    // Number of parts already put into each cell
+    std::vector<int> cell_fill( mount_width * mount_height, 0 );
 
     // Main loop over all vehicle parts.
     for( size_t p = 0; p < parts.size(); p++ ) {
@@ -4683,16 +4795,21 @@ void vehicle::refresh()
         if( vpi.has_flag( "ATOMIC_LIGHT" ) ) {
             has_atomic_lights = true;
         }
-        // Build map of point -> all parts in that point
-        const point pt = parts[p].mount;
+        // Add the part to the index of its mount point
+        const point &pt = parts[p].mount;
+        const int cell = ( pt.y - mount_min.y ) * mount_width + ( pt.x - mount_min.x );
+        const auto cell_begin = relative_parts.begin() + relative_parts_offset[cell];
+        const auto cell_end = cell_begin + cell_fill[cell]++;
         // This will keep the parts at point pt sorted
-        vii = std::lower_bound( relative_parts[pt].begin(), relative_parts[pt].end(), p, svpv );
-        relative_parts[pt].insert( vii, p );
+        const auto vii = std::lower_bound( cell_begin, cell_end, p, svpv );
+        std::copy_backward( vii, cell_end, cell_end + 1 );
+        *vii = p;
     }
 
     precalc_mounts( 0, face.dir() );
     check_environmental_effects = true;
     insides_dirty = true;
+    invalidate_stats();
 }
 
 void vehicle::remove_remote_part(int part_num) {
@@ -4749,8 +4866,7 @@ void vehicle::refresh_insides ()
         for (int i = 0; i < 4; i++) { // let's check four neighbour parts
             int ndx = i < 2? (i == 0? -1 : 1) : 0;
             int ndy = i < 2? 0 : (i == 2? - 1: 1);
-            std::vector<int> parts_n3ar = parts_at_relative (parts[p].mount.x + ndx,
-                                                             parts[p].mount.y + ndy);
+            const part_range parts_n3ar = parts_at_mount( parts[p].mount + point( ndx, ndy ) );
             bool cover = false; // if we aren't covered from sides, the roof at p won't save us
             for (auto &j : parts_n3ar) {
                 if (part_flag(j, "ROOF") && parts[j].hp > 0) { // another roof -- cover
@@ -4893,7 +5009,7 @@ void vehicle::shift_parts( const point delta )
  * @return bool true if the shift was needed.
  */
 bool vehicle::shift_if_needed() {
-    if( !parts_at_relative(0, 0).empty() ) {
+    if( !parts_at_mount( point( 0, 0 ) ).empty() ) {
         // Shifting is not needed.
         return false;
     }
@@ -5022,6 +5138,7 @@ int vehicle::damage_direct (int p, int dmg, int type)
             remove_part (p);
         }
     }
+    invalidate_stats();
     if (dres < 0)
         dres = 0;
     return dres;
@@ -303,6 +303,11 @@ private:
     //Refresh all caches and re-locate all parts
     void refresh();
 
+    // Uncached versions of the values in stats_cache
+    int calc_total_mass() const;
+    float calc_wheels_area( int &cnt ) const;
+    float calc_k_aerodynamics() const;
+
     // Do stuff like clean up blood and produce smoke from broken parts. Returns false if nothing needs doing.
     bool do_environmental_effects();
 
@@ -417,6 +422,34 @@ public:
     // returns the list of indeces of parts at certain position (not accounting frame direction)
     std::vector<int> parts_at_relative (int dx, int dy, bool use_cache = true) const;
 
+    /** A range of part indices, returned by @ref parts_at_mount. */
+    struct part_range {
+        const int *first;
+        const int *last;
+
+        const int *begin() const {
+            return first;
+        }
+        const int *end() const {
+            return last;
+        }
+        bool empty() const {
+            return first == last;
+        }
+        size_t size() const {
+            return last - first;
+        }
+        int operator[]( size_t i ) const {
+            return first[i];
+        }
+    };
+    /**
+     * Same as the cached version of @ref parts_at_relative, but returns a range into
+     * the mount point index instead of a copy. The range is only valid until the next
+     * call to @ref refresh.
+     */
+    part_range parts_at_mount( const point &mount ) const;
+
     // returns index of part, inner to given, with certain flag, or -1
     int part_with_feature (int p, const std::string &f, bool unbroken = true) const;
     int part_with_feature (int p, vpart_bitflags f, bool unbroken = true) const;
@@ -635,7 +668,8 @@ public:
 
     // handle given part collision with vehicle, monster/NPC/player or terrain obstacle
     // return collision, which has type, impulse, part, & target.
-    veh_collision part_collision (int part, int x, int y, bool just_detect);
+    // check_bodies = false skips looking for monsters/NPCs/player (see collision).
+    veh_collision part_collision (int part, int x, int y, bool just_detect, bool check_bodies = true);
 
     // Process the trap beneath
     void handle_trap (int x, int y, int part);
@@ -670,6 +704,17 @@ public:
 
     void refresh_insides ();
 
+    /**
+     * Marks the cached totals (mass, wheel area, aerodynamics, fuel capacity) as outdated.
+     * Must be called after changing the hp, cargo or passengers of parts directly, installing
+     * and removing parts does it through refresh. add_item/remove_item do it as well.
+     * Cargo that changes its type in place (item::make, e.g. transformed tools) is not
+     * noticed, map::vehmove calls this every turn so the mass is at most a turn outdated.
+     */
+    void invalidate_stats();
+    /** Whether the cached totals (if any) equal freshly calculated ones. */
+    bool stats_cache_is_current() const;
+
     bool is_inside (int p) const;
 
     void unboard_all ();
@@ -814,7 +859,18 @@ public:
     vproto_id type;
     std::vector<vehicle_part> parts;   // Parts which occupy different tiles
     int removed_part_count;            // Subtract from parts.size() to get the real part count.
-    std::map<point, std::vector<int> > relative_parts;    // parts_at_relative(x,y) is used alot (to put it mildly)
+    /**
+     * Index of the not removed parts by mount point, parts_at_relative(x,y) is used alot
+     * (to put it mildly). Mount points are mapped onto the bounding box of all mounts
+     * (starting at mount_min, mount_width wide), the parts at box cell i are
+     * relative_parts[relative_parts_offset[i]] up to relative_parts[relative_parts_offset[i + 1]].
+     * Rebuilt by @ref refresh.
+     */
+    point mount_min;
+    int mount_width;
+    int mount_height;
+    std::vector<int> relative_parts_offset;
+    std::vector<int> relative_parts;
     std::set<label> labels;            // stores labels
     std::vector<int> lights;           // List of light part indices
     std::vector<int> alternators;      // List of alternator indices
@@ -904,6 +960,19 @@ public:
     bool skidding                   = false; // skidding mode
     bool check_environmental_effects= false; // has bloody or smoking parts
     bool insides_dirty              = true;  // "inside" flags are outdated and need refreshing
+
+private:
+    /** Totals over all parts, calculated on first use after @ref invalidate_stats. */
+    struct stats_cache {
+        bool valid = false;
+        int mass = 0;
+        float wheels_area = 0;
+        int wheel_count = 0;
+        float k_aerodynamics = 0;
+        std::map<itype_id, int> fuel_capacity;
+    };
+    mutable stats_cache stats;
+    const stats_cache &get_stats() const;
 };
 
 #endif
@@ -87,57 +87,44 @@ std::pair<int, int> rain_or_acid_level( const int wt )
 }
 
 /**
- * Determine what a funnel has filled out of game, using funnelcontainer.bday as a starting point.
+ * Determine what a funnel has filled since the last check, using funnelcontainer.bday as
+ * a starting point. Funnels are not filled every turn while it rains, instead this is
+ * called when the container is examined, picked up or moved (see map::fill_funnels)
+ * or its submap is loaded.
+ * Partial charges are rounded stochastically, so the expected amount of collected rain
+ * does not depend on how often this is called.
  */
 void retroactively_fill_from_funnel( item &it, const trap &tr, const calendar &endturn,
                                      const tripoint &location )
 {
-    const calendar startturn = calendar( it.bday > 0 ? it.bday - 1 : 0 );
+    const calendar startturn = calendar( it.bday > 0 ? it.bday : 0 );
 
-    if ( startturn > endturn || !tr.is_funnel() ) {
+    if ( startturn >= endturn || !tr.is_funnel() ) {
         return;
     }
     it.bday = endturn; // bday == last fill check
-    int rain_amount = 0;
-    int acid_amount = 0;
-    int rain_turns = 0;
-    int acid_turns = 0;
+    // The turns per charge are inversely proportional to the rain depth, so only the
+    // total depth (in mm/h times turns) is summed up and converted once.
+    double rain_depth = 0.0;
+    double acid_depth = 0.0;
     for( calendar turn(startturn); turn < endturn; turn += 10) {
+        const int turns = std::min( 10, endturn.get_turn() - turn.get_turn() );
         // TODO: Z-level weather
-        switch(g->weatherGen.get_weather_conditions(point(location.x, location.y), turn)) {
-        case WEATHER_DRIZZLE:
-            rain_amount += 4;
-            rain_turns++;
-            break;
-        case WEATHER_RAINY:
-        case WEATHER_THUNDER:
-        case WEATHER_LIGHTNING:
-            rain_amount += 8;
-            rain_turns++;
-            break;
-        case WEATHER_ACID_DRIZZLE:
-            acid_amount += 4;
-            acid_turns++;
-            break;
-        case WEATHER_ACID_RAIN:
-            acid_amount += 8;
-            acid_turns++;
-            break;
-        default:
-            break;
-        }
-    }
-
-    // Technically 0.0 division is OK, but it will be cleaner without it
-    if( rain_amount > 0 ) {
-        int rain = rain_turns / tr.funnel_turns_per_charge( rain_amount );
-        it.add_rain_to_container( false, rain );
-    }
-
-    if( acid_amount > 0 ) {
-        int acid = acid_turns / tr.funnel_turns_per_charge( acid_amount );
-        it.add_rain_to_container( true, acid );
+        const auto wt = g->weatherGen.get_weather_conditions( point( location.x, location.y ), turn );
+        const auto amounts = rain_or_acid_level( wt );
+        rain_depth += turns * amounts.first;
+        acid_depth += turns * amounts.second;
     }
+    const double turns_per_charge = tr.funnel_turns_per_charge( 1 );
+    const double rain = rain_depth / turns_per_charge;
+    const double acid = acid_depth / turns_per_charge;
+
+    const auto round_charges = []( double charges ) {
+        const int whole = charges;
+        return whole + ( x_in_y( charges - whole, 1.0 ) ? 1 : 0 );
+    };
+    it.add_rain_to_container( false, round_charges( rain ) );
+    it.add_rain_to_container( true, round_charges( acid ) );
 }
 
 /**
@@ -226,49 +213,6 @@ double trap::funnel_turns_per_charge( double rain_depth_mm_per_hour ) const
     return turns_per_charge;// / rain_depth_mm_per_hour;
 }
 
-/**
- * Main routine for filling funnels from weather effects.
- */
-void fill_funnels(int rain_depth_mm_per_hour, bool acid, const trap &tr)
-{
-    const double turns_per_charge = tr.funnel_turns_per_charge(rain_depth_mm_per_hour);
-    // Give each funnel on the map a chance to collect the rain.
-    const auto &funnel_locs = g->m.trap_locations( tr.loadid );
-    for( auto loc : funnel_locs ) {
-        int maxcontains = 0;
-        auto items = g->m.i_at( loc );
-        if (one_in(turns_per_charge)) { // todo; fixme. todo; fixme
-            //add_msg("%d mm/h %d tps %.4f: fill",int(calendar::turn),rain_depth_mm_per_hour,turns_per_charge);
-            // This funnel has collected some rain! Put the rain in the largest
-            // container here which is either empty or contains some mixture of
-            // impure water and acid.
-            auto container = items.end();
-            for( auto candidate_container = items.begin(); candidate_container != items.end();
-                 ++candidate_container ) {
-                if ( candidate_container->is_funnel_container( maxcontains ) ) {
-                    container = candidate_container;
-                }
-            }
-
-            if( container != items.end() ) {
-                container->add_rain_to_container(acid, 1);
-                container->bday = int(calendar::turn);
-            }
-        }
-    }
-}
-
-/**
- * Fill funnels and makeshift funnels from weather effects.
- * @see fill_funnels
- */
-void fill_water_collectors(int mmPerHour, bool acid)
-{
-    for( auto &e : trap::get_funnels() ) {
-        fill_funnels( mmPerHour, acid, *e );
-    }
-}
-
 /**
  * Main routine for wet effects caused by weather.
  * Drenching the player is applied after checks against worn and held items.
@@ -276,11 +220,10 @@ void fill_water_collectors(int mmPerHour, bool acid)
  * The warmth of armor is considered when determining how much drench happens.
  *
  * Note that this is not the only place where drenching can happen. For example, moving or swimming into water tiles will also cause drenching.
- * @see fill_water_collectors
  * @see map::decay_fields_and_scent
  * @see player::drench
  */
-void generic_wet(bool acid)
+void generic_wet()
 {
     if ((!g->u.worn_with_flag("RAINPROOF") || one_in(100)) &&
         (!g->u.weapon.has_flag("RAIN_PROTECT") || one_in(20)) && !g->u.has_trait("FEATHERS") &&
@@ -297,18 +240,16 @@ void generic_wet(bool acid)
         }
     }
 
-    fill_water_collectors(4, acid); // fixme; consolidate drench and this.
     g->m.decay_fields_and_scent( 15 );
 }
 
 /**
  * Main routine for very wet effects caused by weather.
  * Similar to generic_wet() but with more aggressive numbers.
- * @see fill_water_collectors
  * @see map::decay_fields_and_scent
  * @see player::drench
  */
-void generic_very_wet(bool acid)
+void generic_very_wet()
 {
     if ((!g->u.worn_with_flag("RAINPROOF") || one_in(50)) &&
         (!g->u.weapon.has_flag("RAIN_PROTECT") || one_in(10)) && !g->u.has_trait("FEATHERS") &&
@@ -324,7 +265,6 @@ void generic_very_wet(bool acid)
         }
     }
 
-    fill_water_collectors(8, acid);
     g->m.decay_fields_and_scent( 45 );
 }
 
@@ -339,7 +279,7 @@ void weather_effect::snowstorm() {};
  */
 void weather_effect::wet()
 {
-    generic_wet(false);
+    generic_wet();
 }
 
 /**
@@ -348,7 +288,7 @@ void weather_effect::wet()
  */
 void weather_effect::very_wet()
 {
-    generic_very_wet(false);
+    generic_very_wet();
 }
 
 /**
@@ -396,7 +336,7 @@ void weather_effect::lightning()
  */
 void weather_effect::light_acid()
 {
-    generic_wet(true);
+    generic_wet();
     if (int(calendar::turn) % 10 == 0 && PLAYER_OUTSIDE) {
         if (g->u.weapon.has_flag("RAIN_PROTECT") && !one_in(3)) {
             add_msg(_("Your %s protects you from the acidic drizzle."), g->u.weapon.tname().c_str());
@@ -443,7 +383,7 @@ void weather_effect::acid()
             }
         }
     }
-    generic_very_wet(true);
+    generic_very_wet();
 }
 
 // Script from wikipedia:
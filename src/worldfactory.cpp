@@ -228,6 +228,7 @@ void worldfactory::set_active_world(WORLDPTR world)
     } else {
         ACTIVE_WORLD_OPTIONS.clear();
     }
+    options_changed();
 }
 
 bool worldfactory::save_world(WORLDPTR world, bool is_conversion)
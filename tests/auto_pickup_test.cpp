@@ -0,0 +1,106 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "auto_pickup.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "stdio.h"
+
+constexpr int NUM_RULES = 500;
+constexpr int NUM_NAMES = 2000;
+
+static std::string verdict( const std::string &name )
+{
+    auto iter = mapAutoPickupItems.find( name );
+    if( iter == mapAutoPickupItems.end() ) {
+        createPickupRules( name );
+        iter = mapAutoPickupItems.find( name );
+    }
+    return iter->second;
+}
+
+// What the rules said before they were split once per rule change.
+static std::string expected_verdict( const std::string &name )
+{
+    bool included = false;
+    for( auto &rule : vAutoPickupRules[APU_MERGED] ) {
+        if( rule.bActive && !rule.bExclude && auto_pickup_match( name, rule.sRule ) ) {
+            included = true;
+        }
+    }
+    for( auto &rule : vAutoPickupRules[APU_MERGED] ) {
+        if( rule.bActive && rule.bExclude && auto_pickup_match( name, rule.sRule ) ) {
+            return "false";
+        }
+    }
+    return included ? "true" : "false";
+}
+
+TEST_CASE("Auto pickup rules decide like matching every rule.") {
+    vAutoPickupRules[APU_GLOBAL] = {
+        cPickupRules( "wood*", true, false ),
+        cPickupRules( "*ArRoW", true, false ),
+        cPickupRules( "*steel*", true, false ),
+        cPickupRules( "*rusty*steel*", true, true ),
+        cPickupRules( "rock", false, false ),
+        cPickupRules( "can*", true, false ),
+    };
+    vAutoPickupRules[APU_CHARACTER] = {
+        cPickupRules( "canteen", true, true ),
+    };
+    merge_vector();
+
+    const std::vector<std::string> names = {
+        "wooden arrow", "Wood", "arrow", "steel chunk", "rusty steel chunk", "rusty chunk",
+        "rock", "can", "canteen", "canned food", "plank", "*"
+    };
+    for( const auto &name : names ) {
+        REQUIRE( verdict( name ) == expected_verdict( name ) );
+    }
+    REQUIRE( verdict( "Wooden Arrow" ) == "true" );
+    REQUIRE( verdict( "rusty steel chunk" ) == "false" );
+    REQUIRE( verdict( "rock" ) == "false" );
+    REQUIRE( verdict( "canteen" ) == "false" );
+
+    // Changing the rules drops the old verdicts.
+    vAutoPickupRules[APU_CHARACTER].clear();
+    merge_vector();
+    REQUIRE( verdict( "canteen" ) == "true" );
+}
+
+TEST_CASE("Auto pickup rule matching throughput.") {
+    vAutoPickupRules[APU_GLOBAL].clear();
+    vAutoPickupRules[APU_CHARACTER].clear();
+    for( int i = 0; i < NUM_RULES; i++ ) {
+        vAutoPickupRules[APU_GLOBAL].push_back(
+            cPickupRules( "*item*" + std::to_string( i ) + "*", true, i % 7 == 0 ) );
+    }
+    merge_vector();
+
+    std::vector<std::string> names;
+    for( int i = 0; i < NUM_NAMES; i++ ) {
+        names.push_back( "test item " + std::to_string( i * 31 % 997 ) );
+    }
+
+    std::vector<std::string> expected;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( const auto &name : names ) {
+        expected.push_back( expected_verdict( name ) );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::string> verdicts;
+    const auto split_start = std::chrono::high_resolution_clock::now();
+    for( const auto &name : names ) {
+        verdicts.push_back( verdict( name ) );
+    }
+    const auto split_end = std::chrono::high_resolution_clock::now();
+    REQUIRE( verdicts == expected );
+
+    const std::chrono::duration<double> diff = end - start;
+    const std::chrono::duration<double> split_diff = split_end - split_start;
+    printf( "%d item names checked against %d rules in %f seconds, %f seconds with split rules.\n",
+            NUM_NAMES, NUM_RULES, diff.count(), split_diff.count() );
+}
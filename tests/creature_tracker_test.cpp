@@ -0,0 +1,91 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "creature_tracker.h"
+#include "monster.h"
+#include "mtype.h"
+#include "line.h"
+#include "rng.h"
+
+#include <chrono>
+#include <vector>
+#include "stdio.h"
+
+constexpr int NUM_MONSTERS = 1000;
+constexpr int NUM_QUERIES = 10000;
+constexpr int MAP_DIMENSION = 132;
+
+static std::vector<int> brute_force_in_range( Creature_tracker &tracker, const tripoint &center,
+        const int range )
+{
+    std::vector<int> result;
+    for( size_t i = 0; i < tracker.size(); i++ ) {
+        const monster &critter = tracker.find( i );
+        if( !critter.is_dead() && rl_dist( center, critter.pos3() ) <= range ) {
+            result.push_back( i );
+        }
+    }
+    return result;
+}
+
+// A few points are outside the map, monsters can be there while the map is shifted.
+static tripoint random_point()
+{
+    return tripoint( rng( -4, MAP_DIMENSION + 3 ), rng( -4, MAP_DIMENSION + 3 ), rng( -1, 1 ) );
+}
+
+TEST_CASE("Creature_tracker range queries match a linear scan over 1000 monsters.") {
+    mtype test_type;
+    test_type.id = "mon_test";
+    test_type.hp = 10;
+    test_type.speed = 100;
+
+    Creature_tracker tracker;
+    while( tracker.size() < NUM_MONSTERS ) {
+        monster critter( &test_type, random_point() );
+        if( tracker.mon_at( critter.pos3() ) == -1 ) {
+            tracker.add( critter );
+        }
+    }
+
+    // Move some around and remove some to make sure the index follows.
+    for( int i = 0; i < NUM_MONSTERS / 10; i++ ) {
+        monster &critter = tracker.find( rng( 0, tracker.size() - 1 ) );
+        const tripoint dest = random_point();
+        if( tracker.mon_at( dest ) == -1 && tracker.update_pos( critter, dest ) ) {
+            critter.spawn( dest );
+        }
+        tracker.remove( rng( 0, tracker.size() - 1 ) );
+    }
+
+    std::vector<tripoint> centers;
+    std::vector<int> ranges;
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        centers.push_back( random_point() );
+        ranges.push_back( rng( 1, 60 ) );
+    }
+
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        REQUIRE( tracker.mons_in_range( centers[i], ranges[i] ) ==
+                 brute_force_in_range( tracker, centers[i], ranges[i] ) );
+    }
+
+    size_t found = 0;
+    const auto start1 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        found += brute_force_in_range( tracker, centers[i], ranges[i] / 4 ).size();
+    }
+    const auto end1 = std::chrono::high_resolution_clock::now();
+
+    const auto start2 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        found -= tracker.mons_in_range( centers[i], ranges[i] / 4 ).size();
+    }
+    const auto end2 = std::chrono::high_resolution_clock::now();
+    REQUIRE( found == 0 );
+
+    const std::chrono::duration<double> diff1 = end1 - start1;
+    const std::chrono::duration<double> diff2 = end2 - start2;
+    printf( "linear scan executed %d times in %f seconds.\n", NUM_QUERIES, diff1.count() );
+    printf( "mons_in_range() executed %d times in %f seconds.\n", NUM_QUERIES, diff2.count() );
+}
@@ -0,0 +1,199 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "effect.h"
+#include "martialarts.h"
+#include "monster.h"
+#include "mtype.h"
+#include "json.h"
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "stdio.h"
+
+// Effects are added with an explicit intensity of 1, an intensity of 0 is reported
+// through add_msg, which needs a running game.
+
+constexpr int NUM_MONSTERS = 100;
+constexpr int NUM_ROUNDS = 1000;
+
+static const std::vector<std::string> test_effects = {
+    "test_stunned", "test_downed", "test_webbed", "test_onfire", "test_docile", "test_sleep"
+};
+
+static void load_test_effect_types()
+{
+    for( const auto &id : test_effects ) {
+        std::istringstream data( "{ \"type\": \"effect_type\", \"id\": \"" + id + "\" }" );
+        JsonIn jsin( data );
+        JsonObject jo = jsin.get_object();
+        load_effect_type( jo );
+    }
+}
+
+// All effect types of the game, so lookups by id search as many types as in a real game.
+static void load_game_effect_types()
+{
+    std::ifstream data( "data/json/effects.json" );
+    REQUIRE( data.good() );
+    JsonIn jsin( data );
+    jsin.start_array();
+    while( !jsin.end_array() ) {
+        JsonObject jo = jsin.get_object();
+        load_effect_type( jo );
+    }
+}
+
+TEST_CASE("Creature effects can be added, queried and removed.") {
+    load_test_effect_types();
+
+    mtype test_type;
+    test_type.id = "mon_test";
+    test_type.hp = 10;
+    test_type.speed = 100;
+
+    monster critter( &test_type, tripoint( 0, 0, 0 ) );
+    REQUIRE( !critter.has_effect( "test_stunned" ) );
+
+    critter.add_effect( "test_stunned", 10, num_bp, false, 1 );
+    critter.add_effect( "test_downed", 20, num_bp, false, 1 );
+    REQUIRE( critter.has_effect( "test_stunned" ) );
+    REQUIRE( critter.has_effect( "test_downed", num_bp ) );
+    REQUIRE( critter.get_effect_dur( "test_downed" ) == 20 );
+    REQUIRE( !critter.has_effect( "test_webbed" ) );
+    // Unknown effect types are ignored.
+    critter.add_effect( "test_not_loaded", 10, num_bp, false, 1 );
+    REQUIRE( !critter.has_effect( "test_not_loaded" ) );
+    REQUIRE( effect_types.count( "test_not_loaded" ) == 0 );
+
+    critter.add_effect( "test_stunned", 5, num_bp, false, 1 );
+    REQUIRE( critter.get_effect_dur( "test_stunned" ) == 15 );
+
+    REQUIRE( critter.remove_effect( "test_stunned" ) );
+    REQUIRE( !critter.has_effect( "test_stunned" ) );
+    REQUIRE( critter.has_effect( "test_downed" ) );
+    REQUIRE( !critter.remove_effect( "test_stunned" ) );
+
+    // Targeted effects are found by num_bp and by their own body part only.
+    // monster::add_effect drops the body part, so this uses the Creature version.
+    critter.Creature::add_effect( "test_webbed", 10, bp_arm_l, false, 1 );
+    critter.Creature::add_effect( "test_webbed", 10, bp_leg_r, false, 1 );
+    REQUIRE( critter.has_effect( "test_webbed" ) );
+    REQUIRE( critter.has_effect( "test_webbed", bp_leg_r ) );
+    REQUIRE( !critter.has_effect( "test_webbed", bp_head ) );
+    REQUIRE( critter.remove_effect( "test_webbed", bp_arm_l ) );
+    REQUIRE( !critter.has_effect( "test_webbed", bp_arm_l ) );
+    REQUIRE( critter.has_effect( "test_webbed" ) );
+    REQUIRE( critter.remove_effect( "test_webbed" ) );
+    REQUIRE( !critter.has_effect( "test_webbed" ) );
+    REQUIRE( critter.has_effect( "test_downed" ) );
+}
+
+TEST_CASE("Different martial arts buffs are different effects.") {
+    load_test_effect_types();
+    std::istringstream data( "{ \"type\": \"martial_art\", \"id\": \"style_test\", "
+                             "\"name\": \"Test\", \"description\": \"Test\", \"static_buffs\": [ "
+                             "{ \"id\": \"test_buff_a\", \"name\": \"A\", \"description\": \"A\", \"buff_duration\": 20 }, "
+                             "{ \"id\": \"test_buff_b\", \"name\": \"B\", \"description\": \"B\", \"buff_duration\": 20 } ] }" );
+    JsonIn jsin( data );
+    JsonObject jo = jsin.get_object();
+    load_martial_art( jo );
+    finialize_martial_arts();
+    REQUIRE( effect_type_loadid( "mabuff:test_buff_a" ) != effect_type_loadid( "mabuff:test_buff_b" ) );
+
+    mtype test_type;
+    test_type.id = "mon_test";
+    test_type.hp = 10;
+    test_type.speed = 100;
+
+    monster critter( &test_type, tripoint( 0, 0, 0 ) );
+    critter.add_effect( "mabuff:test_buff_a", 5, num_bp, false, 1 );
+    REQUIRE( critter.has_effect( "mabuff:test_buff_a" ) );
+    REQUIRE( !critter.has_effect( "mabuff:test_buff_b" ) );
+    REQUIRE( !critter.has_effect( "test_not_loaded" ) );
+
+    critter.add_effect( "mabuff:test_buff_b", 10, num_bp, false, 1 );
+    REQUIRE( critter.get_effect_dur( "mabuff:test_buff_a" ) == 5 );
+    REQUIRE( critter.get_effect_dur( "mabuff:test_buff_b" ) == 10 );
+
+    REQUIRE( critter.remove_effect( "mabuff:test_buff_a" ) );
+    REQUIRE( !critter.has_effect( "mabuff:test_buff_a" ) );
+    REQUIRE( critter.has_effect( "mabuff:test_buff_b" ) );
+}
+
+TEST_CASE("Creature effect lookup throughput.") {
+    load_game_effect_types();
+    REQUIRE( effect_types.size() > 100 );
+
+    // The effects monster::can_act and monster::plan ask for every turn.
+    static const std::vector<std::string> hot_effects = {
+        "stunned", "downed", "webbed", "onfire", "docile", "sleep"
+    };
+    static const effect_type_handle effect_stunned( "stunned" );
+    static const effect_type_handle effect_downed( "downed" );
+    static const effect_type_handle effect_webbed( "webbed" );
+    static const effect_type_handle effect_docile( "docile" );
+
+    mtype test_type;
+    test_type.id = "mon_test";
+    test_type.hp = 10;
+    test_type.speed = 100;
+
+    std::vector<monster> critters;
+    for( int i = 0; i < NUM_MONSTERS; i++ ) {
+        critters.emplace_back( &test_type, tripoint( i, 0, 0 ) );
+        // Every monster gets a different subset of the effects.
+        for( size_t e = 0; e < hot_effects.size(); e++ ) {
+            if( ( i >> e ) & 1 ) {
+                critters.back().add_effect( hot_effects[e], 100, num_bp, true, 1 );
+            }
+        }
+    }
+
+    int found_by_string = 0;
+    const auto start1 = std::chrono::high_resolution_clock::now();
+    for( int round = 0; round < NUM_ROUNDS; round++ ) {
+        for( auto &critter : critters ) {
+            if( critter.has_effect( "stunned" ) || critter.has_effect( "downed" ) ||
+                critter.has_effect( "webbed" ) ) {
+                found_by_string++;
+            }
+            if( critter.has_effect( "docile" ) ) {
+                found_by_string++;
+            }
+        }
+    }
+    const auto end1 = std::chrono::high_resolution_clock::now();
+
+    int found_by_handle = 0;
+    const auto start2 = std::chrono::high_resolution_clock::now();
+    for( int round = 0; round < NUM_ROUNDS; round++ ) {
+        for( auto &critter : critters ) {
+            if( critter.has_effect( effect_stunned ) || critter.has_effect( effect_downed ) ||
+                critter.has_effect( effect_webbed ) ) {
+                found_by_handle++;
+            }
+            if( critter.has_effect( effect_docile ) ) {
+                found_by_handle++;
+            }
+        }
+    }
+    const auto end2 = std::chrono::high_resolution_clock::now();
+
+    int expected = 0;
+    for( int i = 0; i < NUM_MONSTERS; i++ ) {
+        expected += ( ( i & 7 ) != 0 ) + ( ( i >> 4 ) & 1 );
+    }
+    REQUIRE( found_by_string == expected * NUM_ROUNDS );
+    REQUIRE( found_by_handle == expected * NUM_ROUNDS );
+
+    const std::chrono::duration<double> diff1 = end1 - start1;
+    const std::chrono::duration<double> diff2 = end2 - start2;
+    printf( "has_effect( id string ) executed %d times in %f seconds.\n",
+            NUM_MONSTERS * NUM_ROUNDS * 4, diff1.count() );
+    printf( "has_effect( effect_type_handle ) executed %d times in %f seconds.\n",
+            NUM_MONSTERS * NUM_ROUNDS * 4, diff2.count() );
+}
@@ -0,0 +1,182 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "inventory.h"
+#include "item_factory.h"
+#include "itype.h"
+#include "item.h"
+#include "rng.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include "stdio.h"
+
+constexpr int NUM_ITEMS = 1000;
+constexpr int NUM_QUERIES = 20;
+constexpr int NUM_CARRIED = 2500;
+
+static const std::vector<std::string> test_types = {
+    "test_hammer", "test_knife", "test_bag", "test_welder", "test_soldering_iron", "test_rock"
+};
+static const std::vector<std::string> test_qualities = { "HAMMER", "CUT" };
+
+static void add_test_types()
+{
+    static bool added = false;
+    if( added ) {
+        return;
+    }
+    added = true;
+
+    itype *hammer = new itype();
+    hammer->id = "test_hammer";
+    hammer->qualities["HAMMER"] = 3;
+    item_controller->add_item_type( hammer );
+
+    itype *knife = new itype();
+    knife->id = "test_knife";
+    knife->qualities["CUT"] = 1;
+    knife->qualities["HAMMER"] = 1;
+    item_controller->add_item_type( knife );
+
+    itype *bag = new itype();
+    bag->id = "test_bag";
+    bag->container.reset( new islot_container() );
+    item_controller->add_item_type( bag );
+
+    it_tool *welder = new it_tool();
+    welder->id = "test_welder";
+    welder->max_charges = 100;
+    welder->ammo_id = "NULL";
+    item_controller->add_item_type( welder );
+
+    it_tool *soldering_iron = new it_tool();
+    soldering_iron->id = "test_soldering_iron";
+    soldering_iron->subtype = "test_welder";
+    soldering_iron->max_charges = 50;
+    soldering_iron->ammo_id = "NULL";
+    item_controller->add_item_type( soldering_iron );
+
+    itype *rock = new itype();
+    rock->id = "test_rock";
+    item_controller->add_item_type( rock );
+}
+
+static item random_item( int depth = 0 )
+{
+    item it( test_types[rng( 0, test_types.size() - 1 )], 0 );
+    if( it.is_tool() ) {
+        it.charges = rng( 0, 50 );
+    }
+    if( one_in( 10 ) ) {
+        it.item_tags.insert( "PSEUDO" );
+    }
+    if( depth < 2 && ( it.is_container() || one_in( 20 ) ) ) {
+        for( int i = rng( 0, 2 ); i > 0; i-- ) {
+            it.contents.push_back( random_item( depth + 1 ) );
+        }
+    }
+    return it;
+}
+
+// Everything the requirement checks of recipes ask an inventory.
+static std::vector<long> query_all( const inventory &inv )
+{
+    std::vector<long> result;
+    std::vector<std::string> ids = test_types;
+    ids.push_back( "test_not_there" );
+    for( const auto &id : ids ) {
+        result.push_back( inv.amount_of( id, true ) );
+        result.push_back( inv.amount_of( id, false ) );
+        result.push_back( inv.charges_of( id ) );
+    }
+    for( const auto &quality : test_qualities ) {
+        for( int level = 0; level <= 4; level++ ) {
+            for( int amount = 1; amount <= NUM_ITEMS; amount *= 4 ) {
+                result.push_back( inv.has_items_with_quality( quality, level, amount ) );
+            }
+        }
+    }
+    return result;
+}
+
+TEST_CASE("Inventory totals match counting every item.") {
+    add_test_types();
+
+    inventory inv;
+    for( int i = 0; i < NUM_ITEMS; i++ ) {
+        inv.add_item( random_item(), true, false );
+    }
+
+    const std::vector<long> expected = query_all( inv );
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        query_all( inv );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    inv.cache_totals();
+    const auto cached_start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_QUERIES; i++ ) {
+        REQUIRE( query_all( inv ) == expected );
+    }
+    const auto cached_end = std::chrono::high_resolution_clock::now();
+
+    // Copies don't share the totals, adding items drops them.
+    inventory copy = inv;
+    item extra( "test_welder", 0 );
+    extra.charges = 10;
+    copy.add_item( extra, true, false );
+    REQUIRE( copy.charges_of( "test_welder" ) == inv.charges_of( "test_welder" ) + 10 );
+    inv.add_item( extra, true, false );
+    REQUIRE( query_all( inv ) == query_all( copy ) );
+
+    const std::chrono::duration<double> diff = end - start;
+    const std::chrono::duration<double> cached_diff = cached_end - cached_start;
+    printf( "Inventory queries executed %d times in %f seconds, %f seconds with totals.\n",
+            NUM_QUERIES, diff.count(), cached_diff.count() );
+}
+
+TEST_CASE("Adding many items at once stacks them like adding them one by one.") {
+    add_test_types();
+
+    std::vector<item> carried;
+    for( int i = 0; i < NUM_CARRIED; i++ ) {
+        carried.push_back( random_item() );
+        carried.back().damage = rng( 0, 3 );
+        carried.back().invlet = inv_chars[rng( 0, inv_chars.size() - 1 )];
+    }
+    inventory source;
+    for( auto &it : carried ) {
+        source.clone_stack( std::list<item>( 1, it ) );
+    }
+
+    inventory one_by_one;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( auto &it : carried ) {
+        one_by_one.add_item( it, true );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    inventory all_at_once;
+    const auto bulk_start = std::chrono::high_resolution_clock::now();
+    all_at_once += source;
+    const auto bulk_end = std::chrono::high_resolution_clock::now();
+
+    REQUIRE( all_at_once.size() == one_by_one.size() );
+    REQUIRE( all_at_once.num_items() == NUM_CARRIED );
+    const const_invslice expected = one_by_one.const_slice();
+    const const_invslice stacks = all_at_once.const_slice();
+    for( size_t i = 0; i < stacks.size(); i++ ) {
+        REQUIRE( stacks[i]->size() == expected[i]->size() );
+        REQUIRE( stacks[i]->front().typeId() == expected[i]->front().typeId() );
+        REQUIRE( stacks[i]->front().damage == expected[i]->front().damage );
+        REQUIRE( stacks[i]->front().invlet == expected[i]->front().invlet );
+    }
+
+    const std::chrono::duration<double> diff = end - start;
+    const std::chrono::duration<double> bulk_diff = bulk_end - bulk_start;
+    printf( "Adding %d items took %f seconds one by one, %f seconds at once.\n",
+            NUM_CARRIED, diff.count(), bulk_diff.count() );
+}
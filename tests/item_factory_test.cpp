@@ -0,0 +1,71 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "item_factory.h"
+#include "itype.h"
+#include "item.h"
+#include "rng.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "stdio.h"
+
+constexpr int NUM_TYPES = 2000;
+constexpr int NUM_ITEMS = 100000;
+
+static std::vector<std::string> add_test_types()
+{
+    std::vector<std::string> ids;
+    for( int i = 0; i < NUM_TYPES; i++ ) {
+        itype *type = new itype();
+        type->id = "test_item_" + std::to_string( i );
+        item_controller->add_item_type( type );
+        ids.push_back( type->id );
+    }
+    return ids;
+}
+
+TEST_CASE("Item types can be found by id.") {
+    const std::vector<std::string> ids = add_test_types();
+
+    for( const auto &id : ids ) {
+        const itype *type = item_controller->find_template( id );
+        REQUIRE( type->id == id );
+        REQUIRE( item_controller->get_all_itypes().at( id ) == type );
+    }
+
+    // Overriding a type (as mods do) replaces it.
+    itype *replacement = new itype();
+    replacement->id = ids[5];
+    item_controller->add_item_type( replacement );
+    REQUIRE( item_controller->find_template( ids[5] ) == replacement );
+
+    const std::vector<Item_tag> all_ids = item_controller->get_all_itype_ids();
+    REQUIRE( std::is_sorted( all_ids.begin(), all_ids.end() ) );
+}
+
+TEST_CASE("Mass item generation.") {
+    const std::vector<std::string> ids = add_test_types();
+
+    std::vector<std::string> spawn_ids;
+    for( int i = 0; i < NUM_ITEMS; i++ ) {
+        spawn_ids.push_back( ids[rng( 0, NUM_TYPES - 1 )] );
+    }
+
+    std::vector<item> items;
+    items.reserve( NUM_ITEMS );
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( const auto &id : spawn_ids ) {
+        items.emplace_back( id, 0 );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    for( int i = 0; i < NUM_ITEMS; i++ ) {
+        REQUIRE( items[i].typeId() == spawn_ids[i] );
+    }
+
+    const std::chrono::duration<double> diff = end - start;
+    printf( "item( id, turn ) executed %d times in %f seconds.\n", NUM_ITEMS, diff.count() );
+}
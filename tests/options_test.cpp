@@ -0,0 +1,37 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "options.h"
+
+TEST_CASE("Option handles follow changes to the option.") {
+    initOptions();
+
+    static const option<bool> autosave( "AUTOSAVE" );
+    static const option<int> autosave_turns( "AUTOSAVE_TURNS" );
+    static const option<std::string> drop_empty( "DROP_EMPTY" );
+
+    OPTIONS["AUTOSAVE"].setValue( "false" );
+    OPTIONS["AUTOSAVE_TURNS"].setValue( "30" );
+    OPTIONS["DROP_EMPTY"].setValue( "watertight" );
+    REQUIRE( !autosave );
+    REQUIRE( autosave_turns == 30 );
+    REQUIRE( drop_empty.get() == "watertight" );
+
+    OPTIONS["AUTOSAVE"].setNext();
+    OPTIONS["AUTOSAVE_TURNS"].setValue( "45" );
+    REQUIRE( autosave );
+    REQUIRE( autosave_turns == 45 );
+
+    // Replacing the whole map must be announced.
+    auto old_options = OPTIONS;
+    OPTIONS["DROP_EMPTY"].setValue( "all" );
+    REQUIRE( drop_empty.get() == "all" );
+    static int notified = 0;
+    add_options_listener( []() {
+        notified++;
+    } );
+    OPTIONS = old_options;
+    options_changed();
+    REQUIRE( notified == 1 );
+    REQUIRE( drop_empty.get() == "watertight" );
+}
@@ -0,0 +1,226 @@
+#define CATCH_CONFIG_MAIN
+#include "catch/catch.hpp"
+
+#include "game.h"
+#include "map.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "vehicle.h"
+#include "veh_type.h"
+#include "path_info.h"
+#include "mapsharing.h"
+#include "options.h"
+#include "color.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "stdio.h"
+
+constexpr int VEHICLE_WIDTH = 25;
+constexpr int VEHICLE_LENGTH = 20;
+constexpr int NUM_LOOKUPS = 100;
+constexpr int NUM_COLLISION_CHECKS = 100;
+
+static const vpart_str_id frame_id( "frame_vertical" );
+static const vpart_str_id seat_id( "seat" );
+static const vpart_str_id trunk_id( "trunk" );
+
+// What part_with_feature() used to do: look at every part of the vehicle.
+template<typename Flag>
+static std::vector<int> linear_parts_with_feature( const vehicle &veh, int part, Flag flag,
+        bool unbroken )
+{
+    std::vector<int> result;
+    for( size_t i = 0; i < veh.parts.size(); i++ ) {
+        const vehicle_part &vp = veh.parts[i];
+        if( !vp.removed && vp.mount == veh.parts[part].mount && veh.part_flag( i, flag ) &&
+            ( !unbroken || vp.hp > 0 ) ) {
+            result.push_back( i );
+        }
+    }
+    return result;
+}
+
+static void init_game()
+{
+    if( g != nullptr ) {
+        return;
+    }
+    PATH_INFO::init_base_path("");
+    PATH_INFO::init_user_dir("./");
+    PATH_INFO::set_standard_filenames();
+
+    MAP_SHARING::setDefaults();
+
+    initOptions();
+    load_options();
+    initscr();
+    // Vehicle parts parse their colors while loading.
+    init_colors();
+
+    g = new game;
+    g->load_static_data();
+    g->setup();
+}
+
+TEST_CASE("Mount point index of a 500 part vehicle matches a linear scan.") {
+    init_game();
+
+    // Every install_part() call refreshes the vehicle, so this times 500 refreshes of a
+    // growing vehicle.
+    vehicle veh;
+    const auto start1 = std::chrono::high_resolution_clock::now();
+    for( int x = 0; x < VEHICLE_WIDTH; x++ ) {
+        for( int y = 0; y < VEHICLE_LENGTH; y++ ) {
+            // Center the vehicle on the origin so the index has to handle negative mounts.
+            veh.install_part( x - VEHICLE_WIDTH / 2, y - VEHICLE_LENGTH / 2, frame_id, -1, true );
+        }
+    }
+    const auto end1 = std::chrono::high_resolution_clock::now();
+    // Removed parts must not show up in the index after the next refresh.
+    veh.parts[0].removed = true;
+    std::vector<int> seats;
+    for( int x = 0; x < VEHICLE_WIDTH; x += 2 ) {
+        seats.push_back( veh.install_part( x - VEHICLE_WIDTH / 2, 0, seat_id, -1, true ) );
+    }
+
+    for( int x = -VEHICLE_WIDTH; x < VEHICLE_WIDTH; x++ ) {
+        for( int y = -VEHICLE_LENGTH; y < VEHICLE_LENGTH; y++ ) {
+            std::vector<int> cached = veh.parts_at_relative( x, y );
+            std::vector<int> uncached = veh.parts_at_relative( x, y, false );
+            std::sort( cached.begin(), cached.end() );
+            REQUIRE( cached == uncached );
+        }
+    }
+
+    // part_with_feature() looks at the parts of the index cell, it must agree with a scan
+    // of all parts. A broken seat checks the unbroken filter.
+    veh.parts[seats[0]].hp = 0;
+    for( size_t p = 1; p < veh.parts.size(); p++ ) {
+        for( const auto &flag : { "SEAT", "CARGO", "MOUNTABLE", "SEATBELT" } ) {
+            for( const bool unbroken : { true, false } ) {
+                const std::vector<int> expected = linear_parts_with_feature( veh, p, flag, unbroken );
+                const int found = veh.part_with_feature( p, flag, unbroken );
+                if( expected.empty() ) {
+                    REQUIRE( found == -1 );
+                } else {
+                    REQUIRE( std::find( expected.begin(), expected.end(), found ) != expected.end() );
+                }
+            }
+        }
+    }
+
+    int found_indexed = 0;
+    const auto start2 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_LOOKUPS; i++ ) {
+        for( size_t p = 1; p < veh.parts.size(); p++ ) {
+            if( veh.part_with_feature( p, VPFLAG_BOARDABLE ) >= 0 ) {
+                found_indexed++;
+            }
+        }
+    }
+    const auto end2 = std::chrono::high_resolution_clock::now();
+    int found_linear = 0;
+    const auto start3 = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_LOOKUPS; i++ ) {
+        for( size_t p = 1; p < veh.parts.size(); p++ ) {
+            if( veh.part_flag( p, VPFLAG_BOARDABLE ) ||
+                !linear_parts_with_feature( veh, p, VPFLAG_BOARDABLE, true ).empty() ) {
+                found_linear++;
+            }
+        }
+    }
+    const auto end3 = std::chrono::high_resolution_clock::now();
+    REQUIRE( found_indexed == found_linear );
+    REQUIRE( found_indexed > 0 );
+
+    const std::chrono::duration<double> diff1 = end1 - start1;
+    const std::chrono::duration<double> diff2 = end2 - start2;
+    const std::chrono::duration<double> diff3 = end3 - start3;
+    printf( "install_part() executed %d times in %f seconds.\n",
+            VEHICLE_WIDTH * VEHICLE_LENGTH, diff1.count() );
+    printf( "part_with_feature() over all parts executed %d times in %f seconds.\n",
+            NUM_LOOKUPS, diff2.count() );
+    printf( "Linear scan over all parts executed %d times in %f seconds.\n",
+            NUM_LOOKUPS, diff3.count() );
+}
+
+TEST_CASE("Cached vehicle totals follow the cargo.") {
+    init_game();
+
+    vehicle veh;
+    veh.install_part( 0, 0, frame_id, -1, true );
+    const int cargo = veh.install_part( 0, 0, trunk_id, -1, true );
+    REQUIRE( cargo >= 0 );
+    const int empty_mass = veh.total_mass();
+    REQUIRE( veh.stats_cache_is_current() );
+
+    REQUIRE( veh.add_item( cargo, item( "rock", 0 ) ) );
+    REQUIRE( veh.stats_cache_is_current() );
+    const int rock_mass = veh.total_mass();
+
+    // Changing the type of cargo in place is not noticed until the next
+    // invalidate_stats, which map::vehmove does every turn.
+    veh.get_items( cargo ).begin()->make( "anvil" );
+    REQUIRE( !veh.stats_cache_is_current() );
+    REQUIRE( veh.total_mass() == rock_mass );
+    veh.invalidate_stats();
+    REQUIRE( veh.total_mass() > rock_mass );
+    REQUIRE( veh.stats_cache_is_current() );
+
+    veh.remove_item( cargo, 0 );
+    REQUIRE( veh.total_mass() == empty_mass );
+    REQUIRE( veh.stats_cache_is_current() );
+}
+
+TEST_CASE("Collision checks of a 500 part vehicle.") {
+    init_game();
+    // Empty submaps, so loading the map needs neither a world nor mapgen.
+    for( int x = 0; x < MAPSIZE; x++ ) {
+        for( int y = 0; y < MAPSIZE; y++ ) {
+            for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+                std::unique_ptr<submap> sm( new submap() );
+                MAPBUFFER.add_submap( g->get_levx() + x, g->get_levy() + y, z, sm );
+            }
+        }
+    }
+    g->m.load( g->get_levx(), g->get_levy(), g->get_levz(), false );
+    // Open ground everywhere, so every part is checked and nothing is hit.
+    for( int x = 0; x < SEEX * MAPSIZE; x++ ) {
+        for( int y = 0; y < SEEY * MAPSIZE; y++ ) {
+            g->m.ter_set( x, y, "t_pavement" );
+        }
+    }
+    g->u.setpos( tripoint( 0, 0, g->get_levz() ) );
+
+    vehicle veh;
+    for( int x = 0; x < VEHICLE_WIDTH; x++ ) {
+        for( int y = 0; y < VEHICLE_LENGTH; y++ ) {
+            veh.install_part( x - VEHICLE_WIDTH / 2, y - VEHICLE_LENGTH / 2, frame_id, -1, true );
+        }
+    }
+    veh.smx = MAPSIZE / 2;
+    veh.smy = MAPSIZE / 2;
+    veh.smz = g->get_levz();
+    veh.precalc_mounts( 1, 0 );
+
+    std::vector<veh_collision> veh_veh_colls;
+    std::vector<veh_collision> veh_misc_colls;
+    bool can_move = true;
+    int imp = 0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for( int i = 0; i < NUM_COLLISION_CHECKS; i++ ) {
+        REQUIRE( !veh.collision( veh_veh_colls, veh_misc_colls, 1, 0, can_move, imp, true ) );
+        REQUIRE( !veh.collision( veh_veh_colls, veh_misc_colls, 0, 1, can_move, imp, false ) );
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    REQUIRE( can_move );
+    REQUIRE( veh_veh_colls.empty() );
+    REQUIRE( veh_misc_colls.empty() );
+
+    const std::chrono::duration<double> diff = end - start;
+    printf( "collision() executed %d times in %f seconds.\n", 2 * NUM_COLLISION_CHECKS,
+            diff.count() );
+}